@@ -0,0 +1,137 @@
+#include "ai_lod.h"
+#include "config.h"
+#include "enemy.h"
+#include "flow_field.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+    constexpr float SMOOTHING = 0.1f;     // Weight of the newest frame in the moving average
+    constexpr float SHRINK = 0.9f;
+    constexpr float GROW = 1.05f;
+    constexpr float HEADROOM = 0.7f;      // Grow back below this fraction of the budget
+    constexpr float MID_BAND = 400.0f;    // Minimum width of the mid tier
+    constexpr std::size_t INITIAL_FAR_CAPACITY = 4096;
+}
+
+AiLodScheduler& AiLodScheduler::getInstance() {
+    static AiLodScheduler instance;
+    return instance;
+}
+
+AiLodScheduler::AiLodScheduler() : intervalScale_(1) {
+    farEnemies_.reserve(INITIAL_FAR_CAPACITY);
+    farX_.reserve(INITIAL_FAR_CAPACITY);
+    farY_.reserve(INITIAL_FAR_CAPACITY);
+    farTime_.reserve(INITIAL_FAR_CAPACITY);
+    farDistance_.reserve(INITIAL_FAR_CAPACITY);
+    reset();
+}
+
+void AiLodScheduler::reset() {
+    nearRadius_ = Config::AI_LOD_NEAR_RADIUS;
+    midRadius_ = Config::AI_LOD_MID_RADIUS;
+    averageMs_ = 0.0f;
+    frame_ = 0;
+    nearCount_ = midCount_ = farCount_ = 0;
+}
+
+void AiLodScheduler::update(const std::vector<std::unique_ptr<Enemy>>& enemies, const sf::Vector2f& playerPos, float deltaTime) {
+    auto start = std::chrono::steady_clock::now();
+
+    const float nearSq = nearRadius_ * nearRadius_;
+    const float midSq = midRadius_ * midRadius_;
+    const unsigned midInterval = static_cast<unsigned>(Config::AI_LOD_MID_INTERVAL * intervalScale_);
+    const unsigned farInterval = static_cast<unsigned>(Config::AI_LOD_FAR_INTERVAL * intervalScale_);
+    nearCount_ = midCount_ = farCount_ = 0;
+
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        Enemy& enemy = *enemies[i];
+        if (!enemy.isAlive()) continue;
+
+        float distanceSq = wrappedDistanceSq(enemy.getWorldPosition(), playerPos);
+        unsigned slot = enemy.getAiStagger() + frame_;
+
+        if (distanceSq < nearSq) {
+            ++nearCount_;
+            float step = enemy.takePendingAiTime(deltaTime) * enemy.getSpeedMultiplier();
+            enemy.updateAI(playerPos, step);
+            enemy.move(step);
+            enemy.updatePosition(playerPos, sf::Vector2f(0, 0));
+        } else if (distanceSq < midSq) {
+            ++midCount_;
+            if (slot % midInterval != 0) {
+                enemy.bankAiTime(deltaTime);
+                continue;
+            }
+            float step = enemy.takePendingAiTime(deltaTime) * enemy.getSpeedMultiplier();
+            enemy.updateAI(playerPos, step);
+            enemy.move(step);
+            enemy.updatePosition(playerPos, sf::Vector2f(0, 0));
+        } else {
+            ++farCount_;
+            if (slot % farInterval != 0) {
+                enemy.bankAiTime(deltaTime);
+                continue;
+            }
+            float step = enemy.takePendingAiTime(deltaTime) * enemy.getSpeedMultiplier();
+            sf::Vector2f position = enemy.getWorldPosition();
+            farEnemies_.push_back(&enemy);
+            farX_.push_back(position.x);
+            farY_.push_back(position.y);
+            farTime_.push_back(step);
+            farDistance_.push_back(enemy.getSpeed() * step);
+        }
+    }
+    advanceFar(playerPos);
+    ++frame_;
+
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    rebalance(elapsed.count());
+}
+
+void AiLodScheduler::advanceFar(const sf::Vector2f& playerPos) {
+    std::size_t count = farEnemies_.size();
+    if (count == 0) return;
+
+    const FlowField& field = getPlayerFlowField();
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vector2f position(farX_[i], farY_[i]);
+        sf::Vector2f direction = field.sample(position);
+        if (direction.x == 0.0f && direction.y == 0.0f) {
+            // Within a cell of the player; can't happen at far range, but
+            // steer straight in rather than stall
+            sf::Vector2f delta = wrappedDelta(position, playerPos);
+            float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+            if (length > 0.1f) direction = delta / length;
+        }
+        position = wrapWorldPosition(position + direction * farDistance_[i]);
+        farX_[i] = position.x;
+        farY_[i] = position.y;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        farEnemies_[i]->applyDrift(sf::Vector2f(farX_[i], farY_[i]), farTime_[i]);
+    }
+
+    farEnemies_.clear();
+    farX_.clear();
+    farY_.clear();
+    farTime_.clear();
+    farDistance_.clear();
+}
+
+void AiLodScheduler::rebalance(float elapsedMs) {
+    averageMs_ += (elapsedMs - averageMs_) * SMOOTHING;
+
+    if (averageMs_ > Config::AI_BUDGET_MS) {
+        // Over budget: hand more enemies to the cheaper tiers
+        nearRadius_ = std::max(nearRadius_ * SHRINK, Config::AI_LOD_MIN_NEAR_RADIUS);
+        midRadius_ = std::max(midRadius_ * SHRINK, nearRadius_ + MID_BAND);
+    } else if (averageMs_ < Config::AI_BUDGET_MS * HEADROOM) {
+        nearRadius_ = std::min(nearRadius_ * GROW, Config::AI_LOD_NEAR_RADIUS);
+        midRadius_ = std::min(std::max(midRadius_ * GROW, nearRadius_ + MID_BAND), Config::AI_LOD_MID_RADIUS);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+class Enemy;
+
+// Runs enemy AI at a level of detail that depends on distance to the
+// player:
+//   near - updateAI + move every frame
+//   mid  - updateAI + move every few frames with the banked time
+//   far  - every many frames, advanced in bulk with no AI decisions
+// Updates within a tier are staggered by a per-enemy id so the work is
+// spread evenly over frames.
+//
+// The far tier is an aggregate model: due enemies are gathered into flat
+// arrays, moved along the shared flow field (one direction per field
+// cell, whatever is in it) in a single pass, and written back. There are
+// no virtual calls or per-enemy decisions out there. The near/mid radii shrink when the measured AI time goes
+// over Config::AI_BUDGET_MS and grow back when there is headroom.
+class AiLodScheduler {
+public:
+    static AiLodScheduler& getInstance();
+
+    void update(const std::vector<std::unique_ptr<Enemy>>& enemies, const sf::Vector2f& playerPos, float deltaTime);
+    void reset();
+
+    int getNearCount() const { return nearCount_; }
+    int getMidCount() const { return midCount_; }
+    int getFarCount() const { return farCount_; }
+    float getNearRadius() const { return nearRadius_; }
+    float getAverageMs() const { return averageMs_; }
+
+    // Stretch the mid/far update intervals by this factor (quality governor)
+    void setIntervalScale(int scale) { intervalScale_ = scale > 1 ? scale : 1; }
+
+private:
+    AiLodScheduler();
+
+    void advanceFar(const sf::Vector2f& playerPos);
+    void rebalance(float elapsedMs);
+
+    float nearRadius_;
+    float midRadius_;
+    float averageMs_;
+    unsigned frame_;
+    int intervalScale_;
+    int nearCount_;
+    int midCount_;
+    int farCount_;
+
+    // Far enemies due this frame, gathered for the bulk pass
+    std::vector<Enemy*> farEnemies_;
+    std::vector<float> farX_;
+    std::vector<float> farY_;
+    std::vector<float> farTime_;
+    std::vector<float> farDistance_;
+};
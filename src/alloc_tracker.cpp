@@ -0,0 +1,154 @@
+#include "alloc_tracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    constexpr std::size_t SUBSYSTEM_COUNT = static_cast<std::size_t>(AllocSubsystem::COUNT);
+
+    // Counters for the frame in progress; any thread may bump them
+    std::atomic<std::uint64_t> currentCounts[SUBSYSTEM_COUNT];
+    std::atomic<std::uint64_t> currentBytes[SUBSYSTEM_COUNT];
+
+    // Snapshot of the last completed frame, only touched by the game thread
+    AllocStats lastFrame[SUBSYSTEM_COUNT];
+
+    thread_local AllocSubsystem activeSubsystem = AllocSubsystem::GENERAL;
+
+#ifdef ESTATE_TRACK_ALLOCATIONS
+    void recordAllocation(std::size_t size) {
+        std::size_t index = static_cast<std::size_t>(activeSubsystem);
+        currentCounts[index].fetch_add(1, std::memory_order_relaxed);
+        currentBytes[index].fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void* allocate(std::size_t size) {
+        recordAllocation(size);
+        if (size == 0) {
+            size = 1;
+        }
+        for (;;) {
+            if (void* memory = std::malloc(size)) {
+                return memory;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void* allocateNoThrow(std::size_t size) noexcept {
+        try {
+            return allocate(size);
+        } catch (...) {
+            return nullptr;
+        }
+    }
+#endif
+}
+
+bool AllocTracker::isEnabled() {
+#ifdef ESTATE_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocTracker::beginFrame() {
+    for (std::size_t i = 0; i < SUBSYSTEM_COUNT; ++i) {
+        lastFrame[i].count = currentCounts[i].exchange(0, std::memory_order_relaxed);
+        lastFrame[i].bytes = currentBytes[i].exchange(0, std::memory_order_relaxed);
+    }
+}
+
+AllocStats AllocTracker::getFrameStats() {
+    AllocStats total;
+    for (std::size_t i = 0; i < SUBSYSTEM_COUNT; ++i) {
+        total.count += lastFrame[i].count;
+        total.bytes += lastFrame[i].bytes;
+    }
+    return total;
+}
+
+AllocStats AllocTracker::getFrameStats(AllocSubsystem subsystem) {
+    return lastFrame[static_cast<std::size_t>(subsystem)];
+}
+
+AllocStats AllocTracker::getCurrentStats(AllocSubsystem subsystem) {
+    std::size_t index = static_cast<std::size_t>(subsystem);
+    AllocStats stats;
+    stats.count = currentCounts[index].load(std::memory_order_relaxed);
+    stats.bytes = currentBytes[index].load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* AllocTracker::getSubsystemName(AllocSubsystem subsystem) {
+    switch (subsystem) {
+        case AllocSubsystem::GENERAL: return "General";
+        case AllocSubsystem::PLAYER: return "Player";
+        case AllocSubsystem::ENEMIES: return "Enemies";
+        case AllocSubsystem::PROJECTILES: return "Projectiles";
+        case AllocSubsystem::PICKUPS: return "Pickups";
+        case AllocSubsystem::SHOP: return "Shop";
+        case AllocSubsystem::HUD: return "HUD";
+        case AllocSubsystem::SPAWNING: return "Spawning";
+        default: return "Unknown";
+    }
+}
+
+AllocScope::AllocScope(AllocSubsystem subsystem) : previous_(activeSubsystem) {
+    activeSubsystem = subsystem;
+}
+
+AllocScope::~AllocScope() {
+    activeSubsystem = previous_;
+}
+
+#ifdef ESTATE_TRACK_ALLOCATIONS
+
+// Replacement global allocation functions. Over-aligned new/delete keep the
+// library defaults and are not counted.
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocateNoThrow(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Heap allocation instrumentation. Debug builds replace the global
+// operator new/delete to count allocations and bytes per frame, attributed
+// to whichever subsystem scope is active on the allocating thread.
+// Release builds (or -DESTATE_NO_ALLOC_TRACKING) compile the counting out.
+#if !defined(NDEBUG) && !defined(ESTATE_NO_ALLOC_TRACKING)
+#define ESTATE_TRACK_ALLOCATIONS 1
+#endif
+
+enum class AllocSubsystem {
+    GENERAL = 0,
+    PLAYER,
+    ENEMIES,
+    PROJECTILES,
+    PICKUPS,
+    SHOP,
+    HUD,
+    SPAWNING,   // Entity creation; expected to allocate until pooled
+    COUNT
+};
+
+struct AllocStats {
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+};
+
+class AllocTracker {
+public:
+    static bool isEnabled();
+
+    // Close the current frame and start counting a new one
+    static void beginFrame();
+
+    // Totals for the last completed frame
+    static AllocStats getFrameStats();
+    static AllocStats getFrameStats(AllocSubsystem subsystem);
+
+    // Totals for the frame in progress
+    static AllocStats getCurrentStats(AllocSubsystem subsystem);
+
+    static const char* getSubsystemName(AllocSubsystem subsystem);
+};
+
+// Attributes allocations on this thread to a subsystem until destroyed
+class AllocScope {
+public:
+    explicit AllocScope(AllocSubsystem subsystem);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    AllocSubsystem previous_;
+};
@@ -0,0 +1,261 @@
+#include "asset_bundle.h"
+#include "log.h"
+#include "lz4_block.h"
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+AssetBundle& AssetBundle::getInstance() {
+    static AssetBundle instance;
+    return instance;
+}
+
+AssetBundle::AssetBundle() :
+    data_(nullptr),
+    size_(0)
+#ifdef _WIN32
+    , fileHandle_(nullptr),
+    mappingHandle_(nullptr)
+#endif
+{
+}
+
+AssetBundle::~AssetBundle() {
+    close();
+}
+
+bool AssetBundle::open(const std::string& filename) {
+    close();
+
+    if (!mapFile(filename)) {
+        return false;
+    }
+
+    // Validate header
+    AssetPak::Header header;
+    if (size_ < sizeof(header)) {
+        LOG_ERROR("Asset bundle too small: %s", filename.c_str());
+        close();
+        return false;
+    }
+    std::memcpy(&header, data_, sizeof(header));
+
+    if (std::memcmp(header.magic, AssetPak::MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != AssetPak::VERSION) {
+        LOG_ERROR("Asset bundle has wrong format or version: %s", filename.c_str());
+        close();
+        return false;
+    }
+
+    std::size_t indexEnd = sizeof(AssetPak::Header) + static_cast<std::size_t>(header.entryCount) * sizeof(AssetPak::Entry);
+    if (indexEnd > size_) {
+        LOG_ERROR("Asset bundle index is truncated: %s", filename.c_str());
+        close();
+        return false;
+    }
+
+    // Build the path lookup; entries stay in the mapping
+    const AssetPak::Entry* entries = reinterpret_cast<const AssetPak::Entry*>(data_ + sizeof(AssetPak::Header));
+    index_.reserve(header.entryCount);
+    for (std::uint32_t i = 0; i < header.entryCount; ++i) {
+        const AssetPak::Entry& entry = entries[i];
+        if (entry.offset + entry.size > size_) {
+            LOG_WARNING("Skipping out-of-range bundle entry %u", i);
+            continue;
+        }
+        if (entry.compression == static_cast<std::uint32_t>(AssetPak::Compression::NONE) &&
+            entry.rawSize != entry.size) {
+            LOG_WARNING("Skipping inconsistent bundle entry %u", i);
+            continue;
+        }
+        std::string path(entry.path, strnlen(entry.path, AssetPak::MAX_PATH_LENGTH));
+        index_[path] = &entry;
+    }
+
+    return true;
+}
+
+void AssetBundle::close() {
+    index_.clear();
+    unmapFile();
+}
+
+const AssetPak::Entry* AssetBundle::findEntry(const std::string& path) const {
+    auto it = index_.find(path);
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+const unsigned char* AssetBundle::entryBytes(const AssetPak::Entry& entry, std::vector<unsigned char>& scratch) const {
+    const unsigned char* stored = data_ + entry.offset;
+
+    switch (static_cast<AssetPak::Compression>(entry.compression)) {
+        case AssetPak::Compression::NONE:
+            return stored;
+        case AssetPak::Compression::LZ4:
+            scratch.resize(static_cast<std::size_t>(entry.rawSize));
+            if (!Lz4::decompress(stored, static_cast<std::size_t>(entry.size), scratch.data(), scratch.size())) {
+                LOG_WARNING("Corrupt compressed bundle entry: %.*s",
+                            static_cast<int>(AssetPak::MAX_PATH_LENGTH), entry.path);
+                return nullptr;
+            }
+            return scratch.data();
+    }
+    return nullptr;
+}
+
+bool AssetBundle::loadTexture(sf::Texture& texture, const std::string& path) const {
+    const AssetPak::Entry* entry = findEntry(path);
+    if (!entry) {
+        return false;
+    }
+
+    if (entry->kind == static_cast<std::uint32_t>(AssetPak::EntryKind::IMAGE_RGBA)) {
+        std::uint64_t expectedSize = static_cast<std::uint64_t>(entry->width) * entry->height * 4;
+        if (entry->rawSize != expectedSize) {
+            return false;
+        }
+    }
+
+    std::vector<unsigned char> scratch;
+    const unsigned char* bytes = entryBytes(*entry, scratch);
+    if (!bytes) {
+        return false;
+    }
+
+    if (entry->kind == static_cast<std::uint32_t>(AssetPak::EntryKind::IMAGE_RGBA)) {
+        // Upload the pre-decoded pixels directly, no PNG inflate
+        if (!texture.create(entry->width, entry->height)) {
+            return false;
+        }
+        texture.update(bytes);
+        return true;
+    }
+
+    // Encoded image stored verbatim
+    return texture.loadFromMemory(bytes, static_cast<std::size_t>(entry->rawSize));
+}
+
+bool AssetBundle::loadFont(sf::Font& font, const std::string& path) const {
+    // The font keeps reading from this memory, so it has to be the mapping
+    // itself rather than a decompressed copy
+    const AssetPak::Entry* entry = findEntry(path);
+    if (!entry || entry->kind != static_cast<std::uint32_t>(AssetPak::EntryKind::RAW) ||
+        entry->compression != static_cast<std::uint32_t>(AssetPak::Compression::NONE)) {
+        return false;
+    }
+
+    return font.loadFromMemory(data_ + entry->offset, static_cast<std::size_t>(entry->size));
+}
+
+#ifdef _WIN32
+
+bool AssetBundle::mapFile(const std::string& filename) {
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle_ = file;
+    mappingHandle_ = mapping;
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void AssetBundle::unmapFile() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mappingHandle_) {
+        CloseHandle(static_cast<HANDLE>(mappingHandle_));
+    }
+    if (fileHandle_) {
+        CloseHandle(static_cast<HANDLE>(fileHandle_));
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mappingHandle_ = nullptr;
+    fileHandle_ = nullptr;
+}
+
+#else
+
+bool AssetBundle::mapFile(const std::string& filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+
+    data_ = static_cast<const unsigned char*>(mapped);
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+    return true;
+}
+
+void AssetBundle::unmapFile() {
+    if (data_) {
+        munmap(const_cast<unsigned char*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+bool loadTextureAsset(sf::Texture& texture, const std::string& path) {
+    if (AssetBundle::getInstance().loadTexture(texture, path)) {
+        return true;
+    }
+    return texture.loadFromFile(path);
+}
+
+bool loadFontAsset(sf::Font& font, const std::string& path) {
+    if (AssetBundle::getInstance().loadFont(font, path)) {
+        return true;
+    }
+    return font.loadFromFile(path);
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// On-disk layout of assets.pak, written by tools/pack_assets.cpp:
+//   Header | Entry[entryCount] | blobs (each aligned to BLOB_ALIGNMENT)
+// Images are stored pre-decoded as RGBA8 so startup never inflates PNGs. The
+// pixels are LZ4 block compressed, which decodes an order of magnitude faster
+// than PNG and keeps the large backgrounds to a few MB each.
+// Fonts stay uncompressed: SFML reads glyphs lazily from the mapped bytes.
+namespace AssetPak {
+    constexpr char MAGIC[8] = {'E', 'S', 'T', 'P', 'A', 'K', '\0', '\0'};
+    constexpr std::uint32_t VERSION = 2;
+    constexpr std::size_t MAX_PATH_LENGTH = 112;
+    constexpr std::size_t BLOB_ALIGNMENT = 16;
+
+    enum class EntryKind : std::uint32_t {
+        RAW = 0,        // Bytes copied verbatim (fonts)
+        IMAGE_RGBA = 1  // Decoded image, width * height * 4 bytes
+    };
+
+    enum class Compression : std::uint32_t {
+        NONE = 0,
+        LZ4 = 1  // LZ4 block (src/lz4_block.h), inflates to rawSize bytes
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+    };
+
+    struct Entry {
+        char path[MAX_PATH_LENGTH]; // e.g. "assets/textures/enemies/grunt.png"
+        std::uint32_t kind;
+        std::uint32_t compression;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint64_t offset;       // From start of file
+        std::uint64_t size;         // Stored size in bytes
+        std::uint64_t rawSize;      // Size once decompressed (== size if NONE)
+    };
+}
+
+// Read-only view of a memory-mapped asset bundle
+class AssetBundle {
+public:
+    static AssetBundle& getInstance();
+
+    // Map the bundle into memory. Fonts read glyphs lazily from the mapping,
+    // so keep the bundle open for as long as any bundled font is alive.
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen() const { return data_ != nullptr; }
+
+    // Create assets straight from the mapped bytes, false if not bundled
+    bool loadTexture(sf::Texture& texture, const std::string& path) const;
+    bool loadFont(sf::Font& font, const std::string& path) const;
+
+private:
+    AssetBundle();
+    ~AssetBundle();
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    const AssetPak::Entry* findEntry(const std::string& path) const;
+    // Bytes of an entry: straight from the mapping, or inflated into scratch
+    const unsigned char* entryBytes(const AssetPak::Entry& entry, std::vector<unsigned char>& scratch) const;
+    bool mapFile(const std::string& filename);
+    void unmapFile();
+
+    const unsigned char* data_;
+    std::size_t size_;
+    std::unordered_map<std::string, const AssetPak::Entry*> index_;
+
+#ifdef _WIN32
+    void* fileHandle_;
+    void* mappingHandle_;
+#endif
+};
+
+// Load from the bundle when it has the asset, otherwise from the loose file
+bool loadTextureAsset(sf::Texture& texture, const std::string& path);
+bool loadFontAsset(sf::Font& font, const std::string& path);
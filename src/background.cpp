@@ -1,6 +1,7 @@
 #include "background.h"
+#include "asset_bundle.h"
 #include "config.h"
-#include <iostream>
+#include "log.h"
 
 Background::Background() : isLoaded(false) {
     // Set texture to repeat for potential wrapping effects
@@ -8,8 +9,8 @@ Background::Background() : isLoaded(false) {
 }
 
 bool Background::loadFromFile(const std::string& filename) {
-    if (!backgroundTexture.loadFromFile(filename)) {
-        std::cerr << "Failed to load background texture: " << filename << std::endl;
+    if (!loadTextureAsset(backgroundTexture, filename)) {
+        LOG_ERROR("Failed to load background texture: %s", filename.c_str());
         isLoaded = false;
         return false;
     }
@@ -1,6 +1,7 @@
 #include "background_menu.h"
+#include "asset_bundle.h"
 #include "config.h"
-#include <iostream>
+#include "log.h"
 
 BackgroundMenu::BackgroundMenu() 
     : selectedIndex(0), menuActive(false), selectedBackground(BackgroundType::FOREST),
@@ -11,8 +12,8 @@ BackgroundMenu::BackgroundMenu()
 
 bool BackgroundMenu::initialize() {
     // Load font
-    if (!font.loadFromFile("assets/ARIAL.TTF")) {
-        std::cerr << "Failed to load font from assets/ARIAL.TTF" << std::endl;
+    if (!loadFontAsset(font, "assets/ARIAL.TTF")) {
+        LOG_ERROR("Failed to load font from assets/ARIAL.TTF");
         return false;
     }
     
@@ -1,10 +1,9 @@
 #include "background_factory.h"
 #include <random>
-#include <iostream>
 
 std::unique_ptr<Background> createBackground(BackgroundType type) {
     auto background = std::make_unique<Background>();
-    BackgroundInfo info = getBackgroundInfo(type);
+    const BackgroundInfo& info = getBackgroundInfo(type);
     
     if (!background->loadFromFile(info.filename)) {
         return nullptr;
@@ -14,7 +13,7 @@ std::unique_ptr<Background> createBackground(BackgroundType type) {
 }
 
 std::unique_ptr<Background> createRandomBackground() {
-    auto backgrounds = getAvailableBackgrounds();
+    const auto& backgrounds = getAvailableBackgrounds();
     
     // Don't include CUSTOM in random selection
     std::vector<BackgroundInfo> selectableBackgrounds;
@@ -1,7 +1,8 @@
 #include "background_types.h"
 
-std::vector<BackgroundInfo> getAvailableBackgrounds() {
-    return {
+const std::vector<BackgroundInfo>& getAvailableBackgrounds() {
+    // Built once; callers get a reference instead of a fresh copy
+    static const std::vector<BackgroundInfo> backgrounds = {
         BackgroundInfo(BackgroundType::FOREST, "Forest", "Dense woodland with tall trees and green foliage", "assets/backgrounds/forest.png"),
         BackgroundInfo(BackgroundType::DESERT, "Desert", "Sandy dunes under a burning sun", "assets/backgrounds/desert.png"),
         BackgroundInfo(BackgroundType::OCEAN, "Ocean", "Deep blue waters with waves and islands", "assets/backgrounds/ocean.png"),
@@ -10,10 +11,11 @@ std::vector<BackgroundInfo> getAvailableBackgrounds() {
         BackgroundInfo(BackgroundType::SPACE, "Space", "Cosmic void with stars and nebulae", "assets/backgrounds/space.png"),
         BackgroundInfo(BackgroundType::CUSTOM, "Custom", "Your own custom background", "assets/background.png")
     };
+    return backgrounds;
 }
 
-BackgroundInfo getBackgroundInfo(BackgroundType type) {
-    auto backgrounds = getAvailableBackgrounds();
+const BackgroundInfo& getBackgroundInfo(BackgroundType type) {
+    const auto& backgrounds = getAvailableBackgrounds();
     for (const auto& bg : backgrounds) {
         if (bg.type == type) {
             return bg;
@@ -27,7 +27,7 @@ struct BackgroundInfo {
 };
 
 // Get all available backgrounds
-std::vector<BackgroundInfo> getAvailableBackgrounds();
+const std::vector<BackgroundInfo>& getAvailableBackgrounds();
 
 // Get background info by type
-BackgroundInfo getBackgroundInfo(BackgroundType type); 
\ No newline at end of file
+const BackgroundInfo& getBackgroundInfo(BackgroundType type); 
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "beam_system.h"
+#include "enemy.h"
+#include "player.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float BEAM_DURATION = 0.12f;
+    constexpr float HIT_RADIUS = 20.0f;  // Same as a projectile
+}
+
+BeamSystem& BeamSystem::getInstance() {
+    static BeamSystem instance;
+    return instance;
+}
+
+BeamSystem::BeamSystem() : stamp_(0), vertices_(sf::Quads) {
+}
+
+int BeamSystem::fire(const sf::Vector2f& origin, const sf::Vector2f& direction, float length, int damage, int pierce,
+                     float width, const sf::Color& color, const SpatialGrid& grid, Player* player) {
+    std::size_t cellCount = static_cast<std::size_t>(grid.getColumns() * grid.getRows());
+    if (cellStamp_.size() != cellCount) {
+        cellStamp_.assign(cellCount, 0);
+    }
+
+    const std::size_t maxHits = pierce < 0 ? grid.getItemCount() : static_cast<std::size_t>(pierce) + 1;
+    const float radiusSq = HIT_RADIUS * HIT_RADIUS;
+    const float cellSize = grid.getCellSize();
+    hits_.clear();
+
+    // A beam running over the world's edge carries on across it: the ray is
+    // walked once per copy of the world it reaches, each from its own start
+    sf::Vector2f end = origin + direction * length;
+    sf::FloatRect reach(std::min(origin.x, end.x) - HIT_RADIUS, std::min(origin.y, end.y) - HIT_RADIUS,
+                        std::fabs(end.x - origin.x) + 2.0f * HIT_RADIUS, std::fabs(end.y - origin.y) + 2.0f * HIT_RADIUS);
+    bool done = false;
+    forEachWorldImage(reach, [&](const sf::Vector2f& shift) {
+        if (done) return;
+        if (++stamp_ == 0) {
+            // Wrapped around; old stamps could collide
+            std::fill(cellStamp_.begin(), cellStamp_.end(), 0);
+            stamp_ = 1;
+        }
+        sf::Vector2f start = origin + shift;
+
+        // Enemies near a cell border can overlap the ray from a neighbouring
+        // cell, so each cell on the ray also pulls in its eight neighbours
+        grid.forEachCellOnRay(start, direction, length, [&](int cx, int cy, float tEnter) {
+            if (done) return;
+
+            // Nothing found from here on can be nearer than this
+            if (hits_.size() >= maxHits) {
+                float horizon = tEnter - 2.0f * cellSize;
+                std::size_t nearer = 0;
+                for (const Hit& hit : hits_) {
+                    if (hit.distance < horizon) ++nearer;
+                }
+                if (nearer >= maxHits) {
+                    done = true;
+                    return;
+                }
+            }
+
+            for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, grid.getRows() - 1); ++ny) {
+                for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, grid.getColumns() - 1); ++nx) {
+                    std::uint32_t& cellStamp = cellStamp_[ny * grid.getColumns() + nx];
+                    if (cellStamp == stamp_) continue;
+                    cellStamp = stamp_;
+
+                    grid.forEachInCell(nx, ny, [&](std::size_t item) {
+                        sf::Vector2f offset = grid.getPosition(item) - start;
+                        float along = offset.x * direction.x + offset.y * direction.y;
+                        if (along < 0.0f || along > length) return;
+                        float acrossSq = offset.x * offset.x + offset.y * offset.y - along * along;
+                        if (acrossSq <= radiusSq && grid.getEnemy(item)->isAlive()) {
+                            hits_.push_back({item, along});
+                        }
+                    });
+                }
+            }
+        });
+    });
+
+    // Nearest hits take the damage
+    std::size_t hitCount = std::min(maxHits, hits_.size());
+    std::partial_sort(hits_.begin(), hits_.begin() + hitCount, hits_.end(),
+                      [](const Hit& a, const Hit& b) { return a.distance < b.distance; });
+
+    int applied = 0;
+    for (std::size_t i = 0; i < hitCount; ++i) {
+        Enemy* enemy = grid.getEnemy(hits_[i].item);
+        bool critical = false;
+        int modifiedDamage = player ? player->calculateModifiedDamage(damage, &critical) : damage;
+        enemy->takeDamage(modifiedDamage, critical);
+        if (player) {
+            player->applyLifeSteal(modifiedDamage);
+        }
+        ++applied;
+    }
+
+    // A beam whose pierce ran out stops at the last enemy it hit
+    float visibleLength = length;
+    if (pierce >= 0 && hitCount == maxHits) {
+        visibleLength = hits_[hitCount - 1].distance;
+    }
+
+    beamStartX_.push_back(origin.x);
+    beamStartY_.push_back(origin.y);
+    beamEndX_.push_back(origin.x + direction.x * visibleLength);
+    beamEndY_.push_back(origin.y + direction.y * visibleLength);
+    beamWidth_.push_back(width);
+    beamAge_.push_back(0.0f);
+    beamColor_.push_back(color);
+
+    return applied;
+}
+
+void BeamSystem::update(float deltaTime) {
+    std::size_t i = 0;
+    while (i < beamAge_.size()) {
+        beamAge_[i] += deltaTime;
+        if (beamAge_[i] < BEAM_DURATION) {
+            ++i;
+            continue;
+        }
+
+        // Swap-remove faded beams
+        std::size_t last = beamAge_.size() - 1;
+        beamStartX_[i] = beamStartX_[last];
+        beamStartY_[i] = beamStartY_[last];
+        beamEndX_[i] = beamEndX_[last];
+        beamEndY_[i] = beamEndY_[last];
+        beamWidth_[i] = beamWidth_[last];
+        beamAge_[i] = beamAge_[last];
+        beamColor_[i] = beamColor_[last];
+        beamStartX_.pop_back();
+        beamStartY_.pop_back();
+        beamEndX_.pop_back();
+        beamEndY_.pop_back();
+        beamWidth_.pop_back();
+        beamAge_.pop_back();
+        beamColor_.pop_back();
+    }
+}
+
+void BeamSystem::draw(sf::RenderWindow& window) const {
+    std::size_t count = beamAge_.size();
+    if (count == 0) return;
+
+    // Each beam is a quad so it can have a width; they all share one array
+    vertices_.resize(count * 4);
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vector2f start(beamStartX_[i], beamStartY_[i]);
+        sf::Vector2f end(beamEndX_[i], beamEndY_[i]);
+        sf::Vector2f along = end - start;
+        float length = std::sqrt(along.x * along.x + along.y * along.y);
+        sf::Vector2f side(0.0f, 0.0f);
+        if (length > 0.0f) {
+            float halfWidth = beamWidth_[i] * 0.5f * (1.0f - beamAge_[i] / BEAM_DURATION);
+            side = sf::Vector2f(-along.y, along.x) * (halfWidth / length);
+        }
+
+        sf::Color color = beamColor_[i];
+        color.a = static_cast<sf::Uint8>(color.a * (1.0f - beamAge_[i] / BEAM_DURATION));
+
+        sf::Vertex* quad = &vertices_[i * 4];
+        quad[0].position = start + side;
+        quad[1].position = end + side;
+        quad[2].position = end - side;
+        quad[3].position = start - side;
+        quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+    }
+
+    window.draw(vertices_);
+}
+
+void BeamSystem::clear() {
+    beamStartX_.clear();
+    beamStartY_.clear();
+    beamEndX_.clear();
+    beamEndY_.clear();
+    beamWidth_.clear();
+    beamAge_.clear();
+    beamColor_.clear();
+}
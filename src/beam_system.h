@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+class Player;
+class SpatialGrid;
+
+// Hitscan beams. fire() resolves a shot immediately by walking the enemy
+// grid cells under the ray (DDA) instead of testing every enemy, and the
+// beam stays on screen briefly. All visible beams are drawn with one call.
+class BeamSystem {
+public:
+    static BeamSystem& getInstance();
+
+    // Hits up to pierce + 1 enemies along the ray, nearest first; a negative
+    // pierce hits everything within length. direction must be normalised.
+    // Returns the number of enemies hit.
+    int fire(const sf::Vector2f& origin, const sf::Vector2f& direction, float length, int damage, int pierce,
+             float width, const sf::Color& color, const SpatialGrid& grid, Player* player = nullptr);
+
+    // Fade out visible beams
+    void update(float deltaTime);
+
+    // Single draw call for all visible beams
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getActiveCount() const { return beamAge_.size(); }
+
+private:
+    BeamSystem();
+
+    struct Hit {
+        std::size_t item;
+        float distance;  // Along the ray
+    };
+
+    // Scratch for fire(); a cell stamp avoids visiting a cell twice per shot
+    std::vector<Hit> hits_;
+    std::vector<std::uint32_t> cellStamp_;
+    std::uint32_t stamp_;
+
+    // Visible beams
+    std::vector<float> beamStartX_;
+    std::vector<float> beamStartY_;
+    std::vector<float> beamEndX_;
+    std::vector<float> beamEndY_;
+    std::vector<float> beamWidth_;
+    std::vector<float> beamAge_;
+    std::vector<sf::Color> beamColor_;
+
+    mutable sf::VertexArray vertices_;
+};
@@ -0,0 +1,149 @@
+#include "combat_text.h"
+#include "asset_bundle.h"
+#include "log.h"
+
+namespace {
+    constexpr std::size_t CAPACITY = 1024;
+    constexpr unsigned GLYPH_SIZE = 18;
+    constexpr float LIFETIME = 0.8f;
+    constexpr float RISE_SPEED = 60.0f;
+    constexpr float CRIT_SCALE = 1.5f;
+    constexpr int MAX_CHARACTERS = 12;  // Digits of any int plus '!'
+}
+
+CombatText& CombatText::getInstance() {
+    static CombatText instance;
+    return instance;
+}
+
+CombatText::CombatText() : loaded_(false), count_(0), vertices_(sf::Quads) {
+    positionX_.resize(CAPACITY);
+    positionY_.resize(CAPACITY);
+    age_.resize(CAPACITY);
+    value_.resize(CAPACITY);
+    critical_.resize(CAPACITY);
+    vertices_.resize(CAPACITY * MAX_CHARACTERS * 4);
+}
+
+bool CombatText::loadFont(const std::string& path) {
+    if (!loadFontAsset(font_, path)) {
+        LOG_WARNING("Combat text disabled: failed to load font %s", path.c_str());
+        return false;
+    }
+
+    // Requesting every glyph up front fills the atlas page for this size
+    // before any rectangles are copied, so none of them move later
+    const char characters[GLYPH_COUNT + 1] = "0123456789!";
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        font_.getGlyph(static_cast<sf::Uint32>(characters[i]), GLYPH_SIZE, true);
+    }
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        const sf::Glyph& glyph = font_.getGlyph(static_cast<sf::Uint32>(characters[i]), GLYPH_SIZE, true);
+        glyphs_[i].bounds = glyph.bounds;
+        glyphs_[i].texture = sf::FloatRect(static_cast<float>(glyph.textureRect.left),
+                                           static_cast<float>(glyph.textureRect.top),
+                                           static_cast<float>(glyph.textureRect.width),
+                                           static_cast<float>(glyph.textureRect.height));
+        glyphs_[i].advance = glyph.advance;
+    }
+    loaded_ = true;
+    return true;
+}
+
+void CombatText::spawn(const sf::Vector2f& position, int value, bool critical) {
+    // A full pool drops new numbers; the screen is unreadable by then anyway
+    if (!loaded_ || count_ == CAPACITY) return;
+    std::size_t i = count_++;
+    positionX_[i] = position.x;
+    positionY_[i] = position.y;
+    age_[i] = 0.0f;
+    value_[i] = value;
+    critical_[i] = critical ? 1 : 0;
+}
+
+void CombatText::update(float deltaTime) {
+    for (std::size_t i = 0; i < count_; ++i) {
+        age_[i] += deltaTime;
+        positionY_[i] -= RISE_SPEED * deltaTime;
+    }
+
+    std::size_t i = 0;
+    while (i < count_) {
+        if (age_[i] < LIFETIME) {
+            ++i;
+            continue;
+        }
+        std::size_t last = --count_;
+        positionX_[i] = positionX_[last];
+        positionY_[i] = positionY_[last];
+        age_[i] = age_[last];
+        value_[i] = value_[last];
+        critical_[i] = critical_[last];
+    }
+}
+
+void CombatText::appendGlyph(std::size_t& vertex, const BakedGlyph& glyph, float penX, float baselineY,
+                             float scale, const sf::Color& color) const {
+    float left = penX + glyph.bounds.left * scale;
+    float top = baselineY + glyph.bounds.top * scale;
+    float right = left + glyph.bounds.width * scale;
+    float bottom = top + glyph.bounds.height * scale;
+    const sf::FloatRect& uv = glyph.texture;
+
+    sf::Vertex* quad = &vertices_[vertex];
+    quad[0].position = sf::Vector2f(left, top);
+    quad[1].position = sf::Vector2f(right, top);
+    quad[2].position = sf::Vector2f(right, bottom);
+    quad[3].position = sf::Vector2f(left, bottom);
+    quad[0].texCoords = sf::Vector2f(uv.left, uv.top);
+    quad[1].texCoords = sf::Vector2f(uv.left + uv.width, uv.top);
+    quad[2].texCoords = sf::Vector2f(uv.left + uv.width, uv.top + uv.height);
+    quad[3].texCoords = sf::Vector2f(uv.left, uv.top + uv.height);
+    quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+    vertex += 4;
+}
+
+void CombatText::draw(sf::RenderWindow& window) const {
+    if (count_ == 0) return;
+
+    std::size_t vertex = 0;
+    int digits[MAX_CHARACTERS];
+    for (std::size_t i = 0; i < count_; ++i) {
+        // Split the value into glyph indices, least significant first
+        int value = value_[i] > 0 ? value_[i] : 0;
+        int length = 0;
+        do {
+            digits[length++] = value % 10;
+            value /= 10;
+        } while (value > 0 && length < MAX_CHARACTERS - 1);
+
+        bool critical = critical_[i] != 0;
+        float scale = critical ? CRIT_SCALE : 1.0f;
+        float fade = 1.0f - age_[i] / LIFETIME;
+        sf::Color color = critical ? sf::Color(255, 200, 40) : sf::Color::White;
+        color.a = static_cast<sf::Uint8>(255 * fade);
+
+        // Centre the string on the spawn point
+        float width = 0.0f;
+        for (int d = 0; d < length; ++d) {
+            width += glyphs_[digits[d]].advance;
+        }
+        if (critical) {
+            width += glyphs_[EXCLAMATION].advance;
+        }
+        float penX = positionX_[i] - width * scale * 0.5f;
+        float baselineY = positionY_[i];
+
+        for (int d = length - 1; d >= 0; --d) {
+            const BakedGlyph& glyph = glyphs_[digits[d]];
+            appendGlyph(vertex, glyph, penX, baselineY, scale, color);
+            penX += glyph.advance * scale;
+        }
+        if (critical) {
+            appendGlyph(vertex, glyphs_[EXCLAMATION], penX, baselineY, scale, color);
+        }
+    }
+
+    sf::RenderStates states(&font_.getTexture(GLYPH_SIZE));
+    window.draw(&vertices_[0], vertex, sf::Quads, states);
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// Floating damage numbers. The digits are baked from the font once at
+// load time and copied out, so drawing never asks the font for glyphs and
+// the atlas texture never changes. Numbers live in a fixed pool (SoA),
+// rise and fade, and every active number is one batch of textured quads
+// drawn in a single call. Critical hits are larger, gold, and get a '!'.
+class CombatText {
+public:
+    static CombatText& getInstance();
+
+    // Bake the glyph atlas; spawn() does nothing until this succeeds
+    bool loadFont(const std::string& path);
+
+    void spawn(const sf::Vector2f& position, int value, bool critical);
+
+    void update(float deltaTime);
+    void draw(sf::RenderWindow& window) const;
+
+    void clear() { count_ = 0; }
+    std::size_t getCount() const { return count_; }
+
+private:
+    CombatText();
+
+    // '0'-'9' then '!'
+    static constexpr int GLYPH_COUNT = 11;
+    static constexpr int EXCLAMATION = 10;
+
+    struct BakedGlyph {
+        sf::FloatRect bounds;   // Quad offset from the pen position
+        sf::FloatRect texture;  // Rectangle in the atlas
+        float advance = 0.0f;
+    };
+
+    void appendGlyph(std::size_t& vertex, const BakedGlyph& glyph, float penX, float baselineY,
+                     float scale, const sf::Color& color) const;
+
+    sf::Font font_;
+    bool loaded_;
+    BakedGlyph glyphs_[GLYPH_COUNT];
+
+    std::size_t count_;
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> age_;
+    std::vector<int> value_;
+    std::vector<unsigned char> critical_;
+
+    mutable sf::VertexArray vertices_;
+};
@@ -19,9 +19,47 @@ namespace Config {
     constexpr int WINDOW_HEIGHT = 600;
     constexpr char WINDOW_TITLE[] = "Estate (Dev Build)";
 
+    // Asset settings
+    constexpr char ASSET_BUNDLE_PATH[] = "assets.pak";
+    constexpr char LOG_FILE_PATH[] = "estate.log";
+
+    // Frame pacing (--vsync / --uncapped switch away from the capped default)
+    constexpr float TARGET_FPS = 60.0f;
+    constexpr int FRAME_PACER_STATS_FRAMES = 120;  // Window for the jitter statistics
+
+    // Scratch memory for per-tick temporaries, rewound every frame
+    constexpr int FRAME_ARENA_SIZE = 256 * 1024;
+
+    // Zero-allocation test (--zero-alloc-test): frames to settle, then frames checked
+    constexpr int ZERO_ALLOC_TEST_WARMUP_FRAMES = 180;
+    constexpr int ZERO_ALLOC_TEST_FRAMES = 600;
+
     // World boundaries
     constexpr float WORLD_WIDTH = 5000.0f;
     constexpr float WORLD_HEIGHT = 5000.0f;
+    constexpr float SPATIAL_GRID_CELL_SIZE = 100.0f;  // Enemy lookup grid used by weapons and AI
+    constexpr float FLOW_FIELD_CELL_SIZE = 200.0f;    // Chase direction field toward the player
+
+    // Crowd separation: enemies closer than this push apart, at up to this speed (px/s)
+    constexpr float SEPARATION_RADIUS = 36.0f;
+    constexpr float SEPARATION_STRENGTH = 180.0f;
+
+    // AI level of detail: full AI every frame near the player, every few
+    // frames mid-range, cheap drift far away. Radii shrink when AI goes
+    // over budget, but never below the visible area.
+    constexpr float AI_LOD_NEAR_RADIUS = 1000.0f;
+    constexpr float AI_LOD_MID_RADIUS = 2000.0f;
+    constexpr float AI_LOD_MIN_NEAR_RADIUS = 600.0f;
+    constexpr int AI_LOD_MID_INTERVAL = 4;    // Frames between mid-range updates
+    constexpr int AI_LOD_FAR_INTERVAL = 16;   // Frames between far updates
+    constexpr float AI_BUDGET_MS = 2.0f;
+    
+    // Quality governor: optional work is scaled back to keep frames in budget
+    constexpr bool QUALITY_GOVERNOR_ENABLED = true;
+    constexpr float FRAME_BUDGET_MS = 16.6f;  // Update + draw time, not counting the display wait
+    
+    // Culling: world-space draws skip anything this far outside the view
+    constexpr float CULL_MARGIN = 120.0f;  // Covers sprite extents and health bars
     
     // Minimap settings
     constexpr float MINIMAP_SIZE = 150.0f;
@@ -29,4 +67,6 @@ namespace Config {
     constexpr float MINIMAP_SCALE = 0.03f;  // Scale factor to fit world into minimap
     constexpr float MINIMAP_PLAYER_SIZE = 4.0f;
     constexpr float MINIMAP_ENEMY_SIZE = 3.0f;
+    constexpr float MINIMAP_REFRESH_INTERVAL = 0.1f;   // Seconds between enemy layer rebuilds
+    constexpr int MINIMAP_HEATMAP_THRESHOLD = 1500;  // Above this many enemies, show density instead of dots
 } 
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "debug_draw.h"
+#include <cmath>
+
+namespace {
+    constexpr int CIRCLE_SEGMENTS = 32;
+    constexpr float PI = 3.14159265f;
+    constexpr unsigned LABEL_SIZE = 12;
+}
+
+DebugDraw& DebugDraw::getInstance() {
+    static DebugDraw instance;
+    return instance;
+}
+
+DebugDraw::DebugDraw() : lines_(sf::Lines), labelCount_(0), font_(nullptr), enabled_(true) {
+    labelText_.setCharacterSize(LABEL_SIZE);
+}
+
+void DebugDraw::addLine(const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& color) {
+    lines_.append(sf::Vertex(from, color));
+    lines_.append(sf::Vertex(to, color));
+}
+
+void DebugDraw::addBox(const sf::FloatRect& rect, const sf::Color& color) {
+    sf::Vector2f topLeft(rect.left, rect.top);
+    sf::Vector2f topRight(rect.left + rect.width, rect.top);
+    sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+    sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+    addLine(topLeft, topRight, color);
+    addLine(topRight, bottomRight, color);
+    addLine(bottomRight, bottomLeft, color);
+    addLine(bottomLeft, topLeft, color);
+}
+
+void DebugDraw::addCircle(const sf::Vector2f& center, float radius, const sf::Color& color) {
+    sf::Vector2f previous(center.x + radius, center.y);
+    for (int s = 1; s <= CIRCLE_SEGMENTS; ++s) {
+        float angle = 2.0f * PI * s / CIRCLE_SEGMENTS;
+        sf::Vector2f next(center.x + std::cos(angle) * radius, center.y + std::sin(angle) * radius);
+        addLine(previous, next, color);
+        previous = next;
+    }
+}
+
+void DebugDraw::addText(const sf::Vector2f& position, const std::string& label, const sf::Color& color) {
+    if (labelCount_ == labels_.size()) {
+        labels_.emplace_back();
+    }
+    Label& entry = labels_[labelCount_++];
+    entry.position = position;
+    entry.color = color;
+    entry.text.assign(label);  // Reuses the slot's buffer from earlier frames
+}
+
+void DebugDraw::submit(sf::RenderWindow& window) {
+    if (lines_.getVertexCount() > 0) {
+        window.draw(lines_);
+    }
+    lines_.clear();
+
+    if (font_) {
+        labelText_.setFont(*font_);
+        for (std::size_t i = 0; i < labelCount_; ++i) {
+            labelText_.setString(labels_[i].text);
+            labelText_.setFillColor(labels_[i].color);
+            labelText_.setPosition(labels_[i].position);
+            window.draw(labelText_);
+        }
+    }
+    labelCount_ = 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include "config.h"
+
+// Immediate-mode debug drawing. Anything can queue lines, boxes, circles
+// and text labels during the frame; flush() submits all the geometry as
+// one line-list draw and then the labels, and empties the queue.
+//
+// Every call is guarded by Config::DEBUG_MODE with if constexpr, so in a
+// non-debug build the calls are empty inline functions and compile away.
+class DebugDraw {
+public:
+    static DebugDraw& getInstance();
+
+    void line(const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& color) {
+        if constexpr (Config::DEBUG_MODE) { if (enabled_) addLine(from, to, color); }
+    }
+    void box(const sf::FloatRect& rect, const sf::Color& color) {
+        if constexpr (Config::DEBUG_MODE) { if (enabled_) addBox(rect, color); }
+    }
+    void circle(const sf::Vector2f& center, float radius, const sf::Color& color) {
+        if constexpr (Config::DEBUG_MODE) { if (enabled_) addCircle(center, radius, color); }
+    }
+    void text(const sf::Vector2f& position, const std::string& label, const sf::Color& color = sf::Color::White) {
+        if constexpr (Config::DEBUG_MODE) { if (enabled_) addText(position, label, color); }
+    }
+
+    // Runtime switch on top of DEBUG_MODE; while off, nothing is queued
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool isEnabled() const { return enabled_; }
+
+    // Font for text labels; labels are skipped until one is set
+    void setFont(const sf::Font& font) { font_ = &font; }
+
+    // Draw everything queued this frame in the window's current view
+    void flush(sf::RenderWindow& window) {
+        if constexpr (Config::DEBUG_MODE) submit(window);
+    }
+
+private:
+    DebugDraw();
+
+    void addLine(const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& color);
+    void addBox(const sf::FloatRect& rect, const sf::Color& color);
+    void addCircle(const sf::Vector2f& center, float radius, const sf::Color& color);
+    void addText(const sf::Vector2f& position, const std::string& label, const sf::Color& color);
+    void submit(sf::RenderWindow& window);
+
+    struct Label {
+        sf::Vector2f position;
+        sf::Color color;
+        std::string text;
+    };
+
+    sf::VertexArray lines_;
+    std::vector<Label> labels_;
+    std::size_t labelCount_;  // Labels in use; entries past this keep their string storage
+    const sf::Font* font_;
+    bool enabled_;
+    sf::Text labelText_;
+};
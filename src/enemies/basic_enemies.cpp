@@ -16,7 +16,7 @@ GruntEnemy::GruntEnemy() : Enemy() {
     if (!loadTexture("assets/textures/enemies/grunt.png")) {
         initializeShape(sf::Vector2f(50.f, 50.f), sf::Color::Red);
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(1.0f, 1.0f)); // Moderate scale increase
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -43,7 +43,7 @@ ScoutEnemy::ScoutEnemy() : Enemy() {
     if (!loadTexture("assets/textures/enemies/scout.png")) {
         initializeShape(sf::Vector2f(35.f, 35.f), sf::Color::Yellow);
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(0.8f, 0.8f)); // Moderate scale increase
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -58,14 +58,17 @@ void ScoutEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
     if (directionChangeTimer >= directionChangeInterval) {
         directionChangeTimer = 0.0f;
         
-        if (rand() % 100 < 50) {
-            targetPosition = playerPos;
-        } else {
+        chasingPlayer = rand() % 100 < 50;
+        if (!chasingPlayer) {
             moveRandomly(deltaTime);
         }
     }
     
-    moveTowards(targetPosition, deltaTime);
+    if (chasingPlayer) {
+        chasePlayer(playerPos, speed, deltaTime);
+    } else {
+        moveTowards(targetPosition, deltaTime);
+    }
 }
 
 void ScoutEnemy::move(float deltaTime) {
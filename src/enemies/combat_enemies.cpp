@@ -1,5 +1,7 @@
 #include "combat_enemies.h"
 #include "../config.h"
+#include "../world_wrap.h"
+#include "../render_queue.h"
 #include <cmath>
 
 // BruteEnemy implementation
@@ -16,7 +18,7 @@ BruteEnemy::BruteEnemy() : Enemy(), chargeSpeed(400.0f), isCharging(false) {
     if (!loadTexture("assets/textures/enemies/brute.png")) {
         initializeShape(sf::Vector2f(80.f, 80.f), sf::Color(139, 69, 19)); // Brown
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(1.5f, 1.5f)); // Moderate scale increase for brute
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -27,15 +29,15 @@ BruteEnemy::BruteEnemy() : Enemy(), chargeSpeed(400.0f), isCharging(false) {
 void BruteEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
     directionChangeTimer += deltaTime;
     
-    // Calculate distance to player
-    sf::Vector2f direction = playerPos - worldPosition;
-    float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    // Squared distance to player, the short way round the world
+    float distanceSq = wrappedDistanceSq(worldPosition, playerPos);
     
     // If close enough, charge at the player
-    if (distance < 200.0f && !isCharging) {
+    if (distanceSq < 200.0f * 200.0f && !isCharging) {
         isCharging = true;
+        chasingPlayer = false;
         targetPosition = playerPos;
-    } else if (distance > 300.0f) {
+    } else if (distanceSq > 300.0f * 300.0f) {
         isCharging = false;
     }
     
@@ -44,23 +46,26 @@ void BruteEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
         
         if (!isCharging) {
             // Normal movement pattern
-            if (rand() % 100 < 80) {
-                targetPosition = playerPos;
-            } else {
+            chasingPlayer = rand() % 100 < 80;
+            if (!chasingPlayer) {
                 moveRandomly(deltaTime);
             }
         }
     }
     
-    // Use charge speed if charging
-    float currentSpeed = isCharging ? chargeSpeed : speed;
-    sf::Vector2f dir = targetPosition - worldPosition;
-    float length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-    
-    if (length > 0.1f) {
-        dir /= length;
-        worldPosition += dir * currentSpeed * deltaTime;
-        wrapPosition();
+    if (isCharging) {
+        // Charge in a straight line at where the player was
+        sf::Vector2f dir = wrappedDelta(worldPosition, targetPosition);
+        float length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+        if (length > 0.1f) {
+            dir /= length;
+            worldPosition += dir * chargeSpeed * deltaTime;
+            wrapPosition();
+        }
+    } else if (chasingPlayer) {
+        chasePlayer(playerPos, speed, deltaTime);
+    } else {
+        moveTowards(targetPosition, deltaTime);
     }
 }
 
@@ -68,7 +73,7 @@ void BruteEnemy::attack(Player& player) {
     // Brute does more damage when charging
     if (attackTimer < attackCooldown) return;
     
-    sf::Vector2f direction = player.getPosition() - sprite.getPosition();
+    sf::Vector2f direction = wrappedDelta(sprite.getPosition(), player.getPosition());
     float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     
     if (distance < attackRange) {
@@ -92,7 +97,7 @@ AssassinEnemy::AssassinEnemy() : Enemy(), stealthTimer(0.0f), isStealthed(false)
     if (!loadTexture("assets/textures/enemies/assassin.png")) {
         initializeShape(sf::Vector2f(45.f, 45.f), sf::Color::Magenta);
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(0.9f, 0.9f)); // Moderate scale increase for assassin
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -114,19 +119,18 @@ void AssassinEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
     }
     
     // Assassin tries to get close then attack
-    sf::Vector2f direction = playerPos - worldPosition;
-    float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    sf::Vector2f direction = wrappedDelta(worldPosition, playerPos);
+    float distanceSq = direction.x * direction.x + direction.y * direction.y;
     
-    if (distance < 100.0f) {
+    if (distanceSq < 100.0f * 100.0f) {
         // Close to player - move directly towards them
-        targetPosition = playerPos;
+        chasingPlayer = true;
     } else if (directionChangeTimer >= directionChangeInterval) {
         directionChangeTimer = 0.0f;
         
         // Far from player - mix of tracking and flanking
-        if (rand() % 100 < 60) {
-            targetPosition = playerPos;
-        } else {
+        chasingPlayer = rand() % 100 < 60;
+        if (!chasingPlayer) {
             // Try to flank the player
             float angle = atan2(direction.y, direction.x) + (rand() % 2 ? 1.5f : -1.5f);
             float flankDistance = 80.0f;
@@ -137,18 +141,30 @@ void AssassinEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
         }
     }
     
-    moveTowards(targetPosition, deltaTime);
+    if (chasingPlayer) {
+        chasePlayer(playerPos, speed, deltaTime);
+    } else {
+        moveTowards(targetPosition, deltaTime);
+    }
 }
 
-void AssassinEnemy::draw(sf::RenderWindow& window) const {
+void AssassinEnemy::submit(RenderQueue& queue) const {
     if (isStealthed) {
-        // Draw semi-transparent when stealthed
+        // Draw semi-transparent when stealthed; the queue copies the quad,
+        // so a temporary sprite is fine
         sf::Sprite stealthSprite = sprite;
         sf::Color stealthColor = sprite.getColor();
         stealthColor.a = 100; // Semi-transparent
         stealthSprite.setColor(stealthColor);
-        window.draw(stealthSprite);
+        queue.submit(stealthSprite, RenderLayer::ACTORS);
     } else {
-        Enemy::draw(window);
+        Enemy::submit(queue);
     }
-} 
\ No newline at end of file
+} 
+
+void AssassinEnemy::addHealthBar(HealthBarBatch& batch) const {
+    // A stealthed assassin doesn't give itself away with a health bar
+    if (!isStealthed) {
+        Enemy::addHealthBar(batch);
+    }
+}
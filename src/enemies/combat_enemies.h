@@ -16,7 +16,8 @@ class AssassinEnemy : public Enemy {
 public:
     AssassinEnemy();
     void updateAI(const sf::Vector2f& playerPos, float deltaTime) override;
-    void draw(sf::RenderWindow& window) const override;
+    void submit(RenderQueue& queue) const override;
+    void addHealthBar(HealthBarBatch& batch) const override;
 private:
     float stealthTimer;
     bool isStealthed;
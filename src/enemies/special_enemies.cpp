@@ -1,5 +1,6 @@
 #include "special_enemies.h"
 #include "../config.h"
+#include "../world_wrap.h"
 #include <cmath>
 
 // SniperEnemy implementation
@@ -16,7 +17,7 @@ SniperEnemy::SniperEnemy() : Enemy(), aimTimer(0.0f), isAiming(false) {
     if (!loadTexture("assets/textures/enemies/sniper.png")) {
         initializeShape(sf::Vector2f(50.f, 50.f), sf::Color::Cyan);
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(1.1f, 1.1f)); // Moderate scale increase for sniper
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -28,8 +29,8 @@ void SniperEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
     directionChangeTimer += deltaTime;
     aimTimer += deltaTime;
     
-    // Calculate distance to player
-    sf::Vector2f direction = playerPos - worldPosition;
+    // Calculate distance to player, the short way round the world
+    sf::Vector2f direction = wrappedDelta(worldPosition, playerPos);
     float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     
     // Sniper tries to maintain distance and aim
@@ -39,10 +40,11 @@ void SniperEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
         isAiming = false;
         aimTimer = 0.0f;
     } else if (distance > SNIPE_RANGE * 1.2f) {
-        // Too far - move closer
-        targetPosition = playerPos;
+        // Too far - close in along the flow field
+        chasePlayer(playerPos, speed, deltaTime);
         isAiming = false;
         aimTimer = 0.0f;
+        return;
     } else {
         // Good range - start aiming
         targetPosition = worldPosition; // Stay in place
@@ -57,7 +59,7 @@ void SniperEnemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
 void SniperEnemy::attack(Player& player) {
     if (attackTimer < attackCooldown || !isAiming) return;
     
-    sf::Vector2f direction = player.getPosition() - sprite.getPosition();
+    sf::Vector2f direction = wrappedDelta(sprite.getPosition(), player.getPosition());
     float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     
     if (distance < SNIPE_RANGE) {
@@ -88,7 +90,7 @@ SwarmEnemy::SwarmEnemy() : Enemy(), swarmRadius(50.0f), orbitAngle(0.0f) {
     if (!loadTexture("assets/textures/enemies/swarm.png")) {
         initializeShape(sf::Vector2f(30.f, 30.f), sf::Color(255, 165, 0)); // Orange
     } else {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(sf::Vector2f(0.7f, 0.7f)); // Moderate scale increase for swarm
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
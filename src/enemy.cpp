@@ -1,10 +1,17 @@
 #include "enemy.h"
+#include "log.h"
 #include <string>
 #include <SFML/Graphics.hpp>
 #include "config.h"
+#include "flow_field.h"
+#include "health_bar_batch.h"
+#include "particle_system.h"
+#include "combat_text.h"
+#include "render_queue.h"
+#include "texture_cache.h"
+#include "world_wrap.h"
 #include <cmath>
 #include <random>
-#include <iostream>
 
 // Base Enemy class implementation
 Enemy::Enemy() : 
@@ -17,9 +24,20 @@ Enemy::Enemy() :
     attackTimer(0.0f),
     experienceValue(25), // Default experience value
     goldValue(5), // Default gold value
+    texture(nullptr),
     directionChangeTimer(0.0f),
     directionChangeInterval(1.0f),
-    showHealthBar(true) {
+    chasingPlayer(false),
+    showHealthBar(true),
+    speedMultiplier(1.0f),
+    pendingAiTime(0.0f) {
+    static unsigned nextAiStagger = 0;
+    aiStagger = nextAiStagger++;
+
+    // No status effects yet
+    for (int& slot : statusSlots) {
+        slot = -1;
+    }
     
     // Initialize world position randomly
     worldPosition = sf::Vector2f(
@@ -28,28 +46,17 @@ Enemy::Enemy() :
     );
     
     targetPosition = worldPosition;
-    
-    // Initialize health bar shapes
-    healthBarBackground.setSize(sf::Vector2f(40.0f, 6.0f));
-    healthBarBackground.setFillColor(sf::Color(50, 50, 50, 200));
-    healthBarBackground.setOutlineThickness(1.0f);
-    healthBarBackground.setOutlineColor(sf::Color::Black);
-    
-    healthBarForeground.setSize(sf::Vector2f(38.0f, 4.0f));
-    healthBarForeground.setFillColor(sf::Color::Green);
 }
 
 bool Enemy::loadTexture(const std::string& texturePath) {
-    if (!texture.loadFromFile(texturePath)) {
-        std::cerr << "Failed to load texture: " << texturePath << std::endl;
-        return false;
-    }
-    return true;
+    // The cache logs the failure once per path, not once per enemy
+    texture = TextureCache::getInstance().get(texturePath);
+    return texture != nullptr;
 }
 
 void Enemy::initializeSprite(const std::string& texturePath, const sf::Vector2f& scale) {
     if (loadTexture(texturePath)) {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setScale(scale);
         
         // Center the origin
@@ -58,19 +65,18 @@ void Enemy::initializeSprite(const std::string& texturePath, const sf::Vector2f&
         sprite.setPosition(worldPosition);
     } else {
         // Fallback to colored rectangle if texture loading fails
-        std::cerr << "Falling back to colored rectangle for enemy" << std::endl;
+        LOG_WARNING("Falling back to colored rectangle for enemy");
         // This will be handled by individual enemy types
     }
 }
 
 void Enemy::initializeShape(const sf::Vector2f& size, const sf::Color& color) {
     // Keep this method for fallback support - convert to sprite-like behavior
-    // Create a simple colored texture programmatically
-    sf::Image image;
-    image.create(static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y), color);
+    // Create a simple colored texture programmatically, shared per size and colour
+    texture = TextureCache::getInstance().getSolid(static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y), color);
     
-    if (texture.loadFromImage(image)) {
-        sprite.setTexture(texture);
+    if (texture) {
+        sprite.setTexture(*texture);
         sprite.setOrigin(size.x / 2.f, size.y / 2.f);
         sprite.setPosition(worldPosition);
     }
@@ -90,18 +96,22 @@ void Enemy::updateAI(const sf::Vector2f& playerPos, float deltaTime) {
     if (directionChangeTimer >= directionChangeInterval) {
         directionChangeTimer = 0.0f;
         
-        if (rand() % 100 < 50) {
-            targetPosition = playerPos;
-        } else {
+        chasingPlayer = rand() % 100 < 50;
+        if (!chasingPlayer) {
             moveRandomly(deltaTime);
         }
     }
     
-    moveTowards(targetPosition, deltaTime);
+    if (chasingPlayer) {
+        chasePlayer(playerPos, speed, deltaTime);
+    } else {
+        moveTowards(targetPosition, deltaTime);
+    }
 }
 
 void Enemy::moveTowards(const sf::Vector2f& target, float deltaTime) {
-    sf::Vector2f direction = target - worldPosition;
+    // Shortest way round, which may cross the world's edge
+    sf::Vector2f direction = wrappedDelta(worldPosition, target);
     float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     
     if (length > 0.1f) {
@@ -111,6 +121,21 @@ void Enemy::moveTowards(const sf::Vector2f& target, float deltaTime) {
     }
 }
 
+void Enemy::chasePlayer(const sf::Vector2f& playerPos, float moveSpeed, float deltaTime) {
+    // Far away the shared flow field gives the direction; near the player
+    // it hands over to steering straight at them
+    sf::Vector2f direction = getPlayerFlowField().sample(worldPosition);
+    if (direction.x == 0.0f && direction.y == 0.0f) {
+        direction = wrappedDelta(worldPosition, playerPos);
+        float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        if (length <= 0.1f) return;
+        direction /= length;
+    }
+
+    worldPosition += direction * moveSpeed * deltaTime;
+    wrapPosition();
+}
+
 void Enemy::moveRandomly(float deltaTime) {
     float angle = (rand() % 360) * (3.14159f / 180.0f);
     float distance = Config::WORLD_WIDTH * 0.1f;
@@ -132,12 +157,34 @@ void Enemy::wrapPosition() {
     if (worldPosition.y > Config::WORLD_HEIGHT) worldPosition.y = 0;
 }
 
+void Enemy::applyDrift(const sf::Vector2f& position, float deltaTime) {
+    // Far-tier stand-in for updateAI + move: no decisions, just the new spot
+    attackTimer += deltaTime;
+    worldPosition = position;
+    sprite.setPosition(worldPosition);
+}
+
+void Enemy::displace(const sf::Vector2f& offset) {
+    worldPosition += offset;
+    wrapPosition();
+    sprite.setPosition(worldPosition);
+}
+
 void Enemy::updatePosition(const sf::Vector2f& playerPos, const sf::Vector2f& cameraOffset) {
     // This method can be called to update AI with player position
     // Individual enemies will override updateAI for specific behaviors
 }
 
-void Enemy::takeDamage(int damage) {
+void Enemy::takeDamage(int damage, bool critical) {
+    health -= damage;
+    if (health < 0) health = 0;
+    if (damage > 0) {
+        ParticleSystem::getInstance().emitHit(worldPosition);
+        CombatText::getInstance().spawn(worldPosition, damage, critical);
+    }
+}
+
+void Enemy::takeTickDamage(int damage) {
     health -= damage;
     if (health < 0) health = 0;
 }
@@ -145,7 +192,7 @@ void Enemy::takeDamage(int damage) {
 void Enemy::attack(Player& player) {
     if (attackTimer < attackCooldown) return;
     
-    sf::Vector2f direction = player.getPosition() - sprite.getPosition();
+    sf::Vector2f direction = wrappedDelta(sprite.getPosition(), player.getPosition());
     float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     
     if (distance < attackRange) {
@@ -158,47 +205,20 @@ bool Enemy::isAlive() const {
     return health > 0;
 }
 
-void Enemy::draw(sf::RenderWindow& window) const {
-    window.draw(sprite);
-    
-    // Draw health bar if enabled and enemy is damaged
-    if (showHealthBar && health < maxHealth) {
-        drawHealthBar(window);
-    }
+void Enemy::submit(RenderQueue& queue) const {
+    queue.submit(sprite, RenderLayer::ACTORS);
 }
 
-void Enemy::drawHealthBar(sf::RenderWindow& window) const {
-    // Position health bar above the enemy
+void Enemy::addHealthBar(HealthBarBatch& batch) const {
+    // Only damaged enemies show a bar
+    if (!showHealthBar || health >= maxHealth) return;
+
+    // Sprites are never rotated, so the scaled local height is the on-screen
+    // height without building the global transform
+    float halfHeight = sprite.getLocalBounds().height * sprite.getScale().y / 2.0f;
     sf::Vector2f enemyPos = sprite.getPosition();
-    sf::FloatRect bounds = sprite.getGlobalBounds();
-    
-    sf::Vector2f healthBarPos(
-        enemyPos.x - healthBarBackground.getSize().x / 2.0f,
-        enemyPos.y - bounds.height / 2.0f - 15.0f
-    );
-    
-    // Draw background
-    healthBarBackground.setPosition(healthBarPos);
-    window.draw(healthBarBackground);
-    
-    // Calculate health percentage and determine color
-    float healthPercentage = static_cast<float>(health) / static_cast<float>(maxHealth);
-    
-    // Color based on health percentage
-    sf::Color healthColor;
-    if (healthPercentage > 0.6f) {
-        healthColor = sf::Color::Green;
-    } else if (healthPercentage > 0.3f) {
-        healthColor = sf::Color::Yellow;
-    } else {
-        healthColor = sf::Color::Red;
-    }
-    
-    // Draw foreground (health bar)
-    healthBarForeground.setFillColor(healthColor);
-    healthBarForeground.setSize(sf::Vector2f(38.0f * healthPercentage, 4.0f));
-    healthBarForeground.setPosition(healthBarPos.x + 1.0f, healthBarPos.y + 1.0f);
-    window.draw(healthBarForeground);
+    batch.add(sf::Vector2f(enemyPos.x, enemyPos.y - halfHeight - 15.0f),
+              static_cast<float>(health) / static_cast<float>(maxHealth));
 }
 
 sf::FloatRect Enemy::getBounds() const {
@@ -6,6 +6,8 @@
 
 // Forward declaration to avoid circular dependency
 class Player;
+class HealthBarBatch;
+class RenderQueue;
 
 // Base Enemy class
 class Enemy {
@@ -17,15 +19,17 @@ public:
     virtual void move(float deltaTime);
     virtual void updateAI(const sf::Vector2f& playerPos, float deltaTime);
     virtual void attack(Player& player);
-    virtual void draw(sf::RenderWindow& window) const;
+    virtual void submit(RenderQueue& queue) const;  // Queue the enemy's sprite for depth-sorted drawing
     
     // Common methods for all enemies
-    void takeDamage(int damage);
+    void takeDamage(int damage, bool critical = false);  // critical only changes the damage number's style
+    void takeTickDamage(int damage);  // Damage over time: no hit burst or number for every point
     bool isAlive() const;
     sf::FloatRect getBounds() const;
     sf::Vector2f getPosition() const { return sprite.getPosition(); }
     sf::Vector2f getWorldPosition() const { return worldPosition; }
     void updatePosition(const sf::Vector2f& playerPos, const sf::Vector2f& cameraOffset);
+    void displace(const sf::Vector2f& offset);  // External push on top of normal movement
     
     // Experience system
     int getExperienceValue() const { return experienceValue; }
@@ -36,11 +40,30 @@ public:
     // Health pack system
     static bool shouldDropHealthPack(const Player& player);
     
-    // Health bar methods
-    void drawHealthBar(sf::RenderWindow& window) const;
+    // Health bar methods. Bars are not part of submit(); the game loop
+    // collects them into one batch after the enemy sprites.
+    virtual void addHealthBar(HealthBarBatch& batch) const;
     void setHealthBarVisible(bool visible) { showHealthBar = visible; }
     bool isHealthBarVisible() const { return showHealthBar; }
 
+    // Status effects. StatusEffectSystem owns the effect data; the enemy only
+    // remembers where its effects live and how much it is slowed.
+    static constexpr int STATUS_SLOT_COUNT = 4;
+    float getSpeedMultiplier() const { return speedMultiplier; }
+    void setSpeedMultiplier(float multiplier) { speedMultiplier = multiplier; }
+    int getStatusSlot(int effect) const { return statusSlots[effect]; }
+    void setStatusSlot(int effect, int slot) { statusSlots[effect] = slot; }
+
+    // AI level of detail. Skipped frames bank their time so a later update
+    // covers it; far enemies are moved in bulk by the scheduler, which hands
+    // back the new position. The stagger is fixed at creation, so erasing
+    // other enemies doesn't change which frames this one updates on.
+    float takePendingAiTime(float deltaTime) { float total = pendingAiTime + deltaTime; pendingAiTime = 0.0f; return total; }
+    void bankAiTime(float deltaTime) { pendingAiTime += deltaTime; }
+    unsigned getAiStagger() const { return aiStagger; }
+    float getSpeed() const { return speed; }
+    void applyDrift(const sf::Vector2f& position, float deltaTime);
+
 protected:
     // Protected members that derived classes can access
     int health;
@@ -54,21 +77,28 @@ protected:
     int goldValue; // Gold dropped when this enemy is killed
     
     sf::Sprite sprite;
-    sf::Texture texture;
+    const sf::Texture* texture;  // Shared through TextureCache
     sf::Vector2f worldPosition;
     sf::Vector2f targetPosition;
     
     // AI state
     float directionChangeTimer;
     float directionChangeInterval;
+    bool chasingPlayer;  // Follow the live player via the flow field instead of targetPosition
     
     // Health bar properties
     bool showHealthBar;
-    mutable sf::RectangleShape healthBarBackground;
-    mutable sf::RectangleShape healthBarForeground;
+
+    // Status effect state, maintained by StatusEffectSystem
+    float speedMultiplier;
+    int statusSlots[STATUS_SLOT_COUNT];
+
+    float pendingAiTime;  // Time owed by the AI LOD scheduler
+    unsigned aiStagger;   // Offset into the scheduler's update intervals
     
     // Helper methods for derived classes
     void moveTowards(const sf::Vector2f& target, float deltaTime);
+    void chasePlayer(const sf::Vector2f& playerPos, float moveSpeed, float deltaTime);
     void moveRandomly(float deltaTime);
     void wrapPosition();
     void initializeSprite(const std::string& texturePath, const sf::Vector2f& scale = sf::Vector2f(1.0f, 1.0f));
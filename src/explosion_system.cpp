@@ -0,0 +1,162 @@
+#include "explosion_system.h"
+#include "enemy.h"
+#include "player.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include <cmath>
+
+namespace {
+    constexpr float FLASH_DURATION = 0.25f;
+    constexpr int FLASH_SEGMENTS = 16;
+    constexpr float PI = 3.14159265f;
+}
+
+ExplosionSystem& ExplosionSystem::getInstance() {
+    static ExplosionSystem instance;
+    return instance;
+}
+
+ExplosionSystem::ExplosionSystem() : vertices_(sf::Triangles) {
+}
+
+void ExplosionSystem::emit(const sf::Vector2f& center, float radius, int damage, float falloff, const sf::Color& color) {
+    pendingX_.push_back(center.x);
+    pendingY_.push_back(center.y);
+    pendingRadius_.push_back(radius);
+    pendingDamage_.push_back(static_cast<float>(damage));
+    pendingFalloff_.push_back(falloff);
+    pendingColor_.push_back(color);
+}
+
+void ExplosionSystem::resolve(const SpatialGrid& grid, Player* player) {
+    std::size_t blastCount = pendingX_.size();
+    if (blastCount == 0) return;
+
+    // Grid items are dense, so the accumulator is a flat array; only the
+    // touched entries are reset afterwards
+    if (accumulated_.size() < grid.getItemCount()) {
+        accumulated_.resize(grid.getItemCount(), 0.0f);
+    }
+
+    for (std::size_t b = 0; b < blastCount; ++b) {
+        sf::Vector2f center(pendingX_[b], pendingY_[b]);
+        float radius = pendingRadius_[b];
+        float damage = pendingDamage_[b];
+        float falloff = pendingFalloff_[b];
+        float inverseRadius = 1.0f / radius;
+
+        // Blasts at the world's edge reach the enemies just across it
+        sf::FloatRect reach(center.x - radius, center.y - radius, 2.0f * radius, 2.0f * radius);
+        forEachWorldImage(reach, [&](const sf::Vector2f& shift) {
+            grid.queryRadius(center + shift, radius, [&](std::size_t item, float distSq) {
+                float scale = 1.0f - falloff * std::sqrt(distSq) * inverseRadius;
+                if (accumulated_[item] == 0.0f) {
+                    touched_.push_back(item);
+                }
+                accumulated_[item] += damage * scale;
+            });
+        });
+
+        // Leave a flash behind for the renderer
+        flashX_.push_back(center.x);
+        flashY_.push_back(center.y);
+        flashRadius_.push_back(radius);
+        flashAge_.push_back(0.0f);
+        flashColor_.push_back(pendingColor_[b]);
+    }
+
+    // One hit per damaged enemy, however many blasts overlapped it
+    for (std::size_t item : touched_) {
+        int total = static_cast<int>(accumulated_[item] + 0.5f);
+        accumulated_[item] = 0.0f;
+
+        Enemy* enemy = grid.getEnemy(item);
+        if (total <= 0 || !enemy->isAlive()) continue;
+
+        bool critical = false;
+        int modifiedDamage = player ? player->calculateModifiedDamage(total, &critical) : total;
+        enemy->takeDamage(modifiedDamage, critical);
+        if (player) {
+            player->applyLifeSteal(modifiedDamage);
+        }
+    }
+    touched_.clear();
+
+    pendingX_.clear();
+    pendingY_.clear();
+    pendingRadius_.clear();
+    pendingDamage_.clear();
+    pendingFalloff_.clear();
+    pendingColor_.clear();
+}
+
+void ExplosionSystem::update(float deltaTime) {
+    std::size_t i = 0;
+    while (i < flashAge_.size()) {
+        flashAge_[i] += deltaTime;
+        if (flashAge_[i] < FLASH_DURATION) {
+            ++i;
+            continue;
+        }
+
+        // Swap-remove expired flashes
+        std::size_t last = flashAge_.size() - 1;
+        flashX_[i] = flashX_[last];
+        flashY_[i] = flashY_[last];
+        flashRadius_[i] = flashRadius_[last];
+        flashAge_[i] = flashAge_[last];
+        flashColor_[i] = flashColor_[last];
+        flashX_.pop_back();
+        flashY_.pop_back();
+        flashRadius_.pop_back();
+        flashAge_.pop_back();
+        flashColor_.pop_back();
+    }
+}
+
+void ExplosionSystem::draw(sf::RenderWindow& window) const {
+    std::size_t count = flashAge_.size();
+    if (count == 0) return;
+
+    // Each flash is a fan of triangles that grows and fades out
+    vertices_.resize(count * FLASH_SEGMENTS * 3);
+    std::size_t v = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        float progress = flashAge_[i] / FLASH_DURATION;
+        float radius = flashRadius_[i] * (0.5f + 0.5f * progress);
+        sf::Vector2f center(flashX_[i], flashY_[i]);
+
+        sf::Color centerColor = flashColor_[i];
+        centerColor.a = static_cast<sf::Uint8>(180 * (1.0f - progress));
+        sf::Color edgeColor = centerColor;
+        edgeColor.a = 0;
+
+        for (int s = 0; s < FLASH_SEGMENTS; ++s) {
+            float a0 = 2.0f * PI * s / FLASH_SEGMENTS;
+            float a1 = 2.0f * PI * (s + 1) / FLASH_SEGMENTS;
+            vertices_[v].position = center;
+            vertices_[v].color = centerColor;
+            vertices_[v + 1].position = center + sf::Vector2f(std::cos(a0) * radius, std::sin(a0) * radius);
+            vertices_[v + 1].color = edgeColor;
+            vertices_[v + 2].position = center + sf::Vector2f(std::cos(a1) * radius, std::sin(a1) * radius);
+            vertices_[v + 2].color = edgeColor;
+            v += 3;
+        }
+    }
+
+    window.draw(vertices_);
+}
+
+void ExplosionSystem::clear() {
+    pendingX_.clear();
+    pendingY_.clear();
+    pendingRadius_.clear();
+    pendingDamage_.clear();
+    pendingFalloff_.clear();
+    pendingColor_.clear();
+    flashX_.clear();
+    flashY_.clear();
+    flashRadius_.clear();
+    flashAge_.clear();
+    flashColor_.clear();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class Player;
+class SpatialGrid;
+
+// Area damage. Impacts queue blast events during the tick; resolve() then
+// handles the whole batch at once: each blast only visits the grid cells
+// under its radius, damage is summed per enemy, and every damaged enemy
+// takes a single hit. Cost scales with enemies actually caught in blasts,
+// not blasts x enemies.
+class ExplosionSystem {
+public:
+    static ExplosionSystem& getInstance();
+
+    // falloff is the fraction of damage lost at the edge of the radius
+    void emit(const sf::Vector2f& center, float radius, int damage, float falloff,
+              const sf::Color& color = sf::Color(255, 140, 0));
+
+    // Apply all queued blasts; talents scale the summed damage per enemy
+    void resolve(const SpatialGrid& grid, Player* player = nullptr);
+
+    // Age the blast flashes left by earlier ticks
+    void update(float deltaTime);
+
+    // Blast flashes, one draw call
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getPendingCount() const { return pendingX_.size(); }
+
+private:
+    ExplosionSystem();
+
+    // Blasts waiting for resolve()
+    std::vector<float> pendingX_;
+    std::vector<float> pendingY_;
+    std::vector<float> pendingRadius_;
+    std::vector<float> pendingDamage_;
+    std::vector<float> pendingFalloff_;
+    std::vector<sf::Color> pendingColor_;
+
+    // Per-grid-item damage accumulator and the items touched this batch
+    std::vector<float> accumulated_;
+    std::vector<std::size_t> touched_;
+
+    // Visual flashes
+    std::vector<float> flashX_;
+    std::vector<float> flashY_;
+    std::vector<float> flashRadius_;
+    std::vector<float> flashAge_;
+    std::vector<sf::Color> flashColor_;
+
+    mutable sf::VertexArray vertices_;
+};
@@ -0,0 +1,70 @@
+#include "flow_field.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+FlowField::FlowField(float worldWidth, float worldHeight, float cellSize) :
+    cellSize_(cellSize),
+    inverseCellSize_(1.0f / cellSize),
+    columns_(std::max(1, static_cast<int>(std::ceil(worldWidth / cellSize)))),
+    rows_(std::max(1, static_cast<int>(std::ceil(worldHeight / cellSize)))),
+    playerCellX_(-1),
+    playerCellY_(-1) {
+    directionX_.assign(static_cast<std::size_t>(columns_ * rows_), 0.0f);
+    directionY_.assign(static_cast<std::size_t>(columns_ * rows_), 0.0f);
+}
+
+void FlowField::update(const sf::Vector2f& playerPos) {
+    int cx = std::min(std::max(static_cast<int>(std::floor(playerPos.x * inverseCellSize_)), 0), columns_ - 1);
+    int cy = std::min(std::max(static_cast<int>(std::floor(playerPos.y * inverseCellSize_)), 0), rows_ - 1);
+    if (cx == playerCellX_ && cy == playerCellY_) return;
+
+    playerCellX_ = cx;
+    playerCellY_ = cy;
+    rebuild();
+}
+
+void FlowField::rebuild() {
+    // With no obstacles a breadth-first search over the torus reduces to the
+    // wrapped cell offset, so each cell is filled directly
+    for (int y = 0; y < rows_; ++y) {
+        int dy = playerCellY_ - y;
+        if (dy > rows_ / 2) dy -= rows_;
+        else if (dy < -rows_ / 2) dy += rows_;
+
+        for (int x = 0; x < columns_; ++x) {
+            int dx = playerCellX_ - x;
+            if (dx > columns_ / 2) dx -= columns_;
+            else if (dx < -columns_ / 2) dx += columns_;
+
+            std::size_t cell = static_cast<std::size_t>(y * columns_ + x);
+            if (std::abs(dx) <= 1 && std::abs(dy) <= 1) {
+                // Close enough to aim at the player itself
+                directionX_[cell] = 0.0f;
+                directionY_[cell] = 0.0f;
+                continue;
+            }
+
+            float length = std::sqrt(static_cast<float>(dx * dx + dy * dy));
+            directionX_[cell] = dx / length;
+            directionY_[cell] = dy / length;
+        }
+    }
+}
+
+int FlowField::cellIndex(const sf::Vector2f& position) const {
+    int cx = std::min(std::max(static_cast<int>(std::floor(position.x * inverseCellSize_)), 0), columns_ - 1);
+    int cy = std::min(std::max(static_cast<int>(std::floor(position.y * inverseCellSize_)), 0), rows_ - 1);
+    return cy * columns_ + cx;
+}
+
+sf::Vector2f FlowField::sample(const sf::Vector2f& position) const {
+    int cell = cellIndex(position);
+    return sf::Vector2f(directionX_[cell], directionY_[cell]);
+}
+
+FlowField& getPlayerFlowField() {
+    static FlowField field(Config::WORLD_WIDTH, Config::WORLD_HEIGHT, Config::FLOW_FIELD_CELL_SIZE);
+    return field;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Coarse direction field toward the player over the wrapped world. Each
+// cell stores a unit vector along the shortest wrapped route from its
+// centre to the player's cell, plus its distance in cells. The field is
+// only rebuilt when the player enters a new cell, so any number of chasers
+// share one rebuild and each sample is a table lookup.
+class FlowField {
+public:
+    FlowField(float worldWidth, float worldHeight, float cellSize);
+
+    // Rebuilds if the player has moved to another cell
+    void update(const sf::Vector2f& playerPos);
+
+    // Unit direction toward the player, or (0, 0) when position is within
+    // a cell of the player and the chaser should steer at the player directly
+    sf::Vector2f sample(const sf::Vector2f& position) const;
+
+    int getColumns() const { return columns_; }
+    int getRows() const { return rows_; }
+    float getCellSize() const { return cellSize_; }
+
+private:
+    void rebuild();
+    int cellIndex(const sf::Vector2f& position) const;
+
+    float cellSize_;
+    float inverseCellSize_;
+    int columns_;
+    int rows_;
+    int playerCellX_;
+    int playerCellY_;
+
+    std::vector<float> directionX_;
+    std::vector<float> directionY_;
+};
+
+// Field toward the current player, updated by the game loop every tick
+FlowField& getPlayerFlowField();
@@ -0,0 +1,191 @@
+#include "force_field_system.h"
+#include "enemy.h"
+#include "explosion_system.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr int FIELD_SEGMENTS = 24;
+    constexpr float PI = 3.14159265f;
+    constexpr float COLLAPSE_RADIUS_SCALE = 0.6f;  // Blast radius relative to the field
+    constexpr float COLLAPSE_FALLOFF = 0.5f;
+}
+
+ForceFieldSystem& ForceFieldSystem::getInstance() {
+    static ForceFieldSystem instance;
+    return instance;
+}
+
+ForceFieldSystem::ForceFieldSystem() : vertices_(sf::Triangles) {
+}
+
+void ForceFieldSystem::spawn(const sf::Vector2f& center, float radius, float strength, float duration, int collapseDamage) {
+    fieldX_.push_back(center.x);
+    fieldY_.push_back(center.y);
+    fieldRadius_.push_back(radius);
+    fieldStrength_.push_back(strength);
+    fieldRemaining_.push_back(duration);
+    fieldDuration_.push_back(duration);
+    fieldCollapseDamage_.push_back(collapseDamage);
+}
+
+void ForceFieldSystem::update(float deltaTime, const SpatialGrid& grid) {
+    if (fieldX_.empty()) return;
+
+    applyForces(deltaTime, grid);
+
+    std::size_t i = 0;
+    while (i < fieldX_.size()) {
+        fieldRemaining_[i] -= deltaTime;
+        if (fieldRemaining_[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+
+        // Whatever got pulled in is right where the blast goes off
+        if (fieldCollapseDamage_[i] > 0) {
+            ExplosionSystem::getInstance().emit(sf::Vector2f(fieldX_[i], fieldY_[i]),
+                                                fieldRadius_[i] * COLLAPSE_RADIUS_SCALE, fieldCollapseDamage_[i],
+                                                COLLAPSE_FALLOFF, sf::Color(160, 60, 255));
+        }
+        remove(i);
+    }
+}
+
+void ForceFieldSystem::applyForces(float deltaTime, const SpatialGrid& grid) {
+    if (displaceX_.size() < grid.getItemCount()) {
+        displaceX_.resize(grid.getItemCount(), 0.0f);
+        displaceY_.resize(grid.getItemCount(), 0.0f);
+    }
+
+    for (std::size_t f = 0; f < fieldX_.size(); ++f) {
+        const float centerX = fieldX_[f];
+        const float centerY = fieldY_[f];
+        const float radius = fieldRadius_[f];
+        const float strength = fieldStrength_[f];
+
+        // Gather candidates from the cells under the field, across the
+        // world's edge too. Grid positions are from the last rebuild, so pad
+        // by the distance an enemy can have moved; the exact test below uses
+        // current positions, taken the short way round from the centre.
+        candidateItem_.clear();
+        candidateX_.clear();
+        candidateY_.clear();
+        const sf::Vector2f center(centerX, centerY);
+        const float reach = radius + grid.getCellSize() * 0.5f;
+        forEachWorldImage(sf::FloatRect(centerX - reach, centerY - reach, 2.0f * reach, 2.0f * reach),
+                          [&](const sf::Vector2f& shift) {
+            grid.queryRadius(center + shift, reach, [&](std::size_t item, float) {
+                Enemy* enemy = grid.getEnemy(item);
+                if (!enemy->isAlive()) return;
+                sf::Vector2f pos = center + wrappedDelta(center, enemy->getWorldPosition());
+                candidateItem_.push_back(item);
+                candidateX_.push_back(pos.x);
+                candidateY_.push_back(pos.y);
+            });
+        });
+
+        // Flat loop over the gathered positions; no branches, so it
+        // vectorises. Outside the radius the weight clamps to zero.
+        std::size_t count = candidateItem_.size();
+        candidateDX_.resize(count);
+        candidateDY_.resize(count);
+        const float inverseRadius = 1.0f / radius;
+        for (std::size_t i = 0; i < count; ++i) {
+            float dx = centerX - candidateX_[i];
+            float dy = centerY - candidateY_[i];
+            float dist = std::sqrt(dx * dx + dy * dy);
+            float weight = std::max(0.0f, 1.0f - dist * inverseRadius);
+            // Never pull past the centre in one step
+            float step = std::min(strength * weight * deltaTime, dist);
+            float scale = step / std::max(dist, 0.001f);
+            candidateDX_[i] = dx * scale;
+            candidateDY_[i] = dy * scale;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t item = candidateItem_[i];
+            if (displaceX_[item] == 0.0f && displaceY_[item] == 0.0f) {
+                touched_.push_back(item);
+            }
+            displaceX_[item] += candidateDX_[i];
+            displaceY_[item] += candidateDY_[i];
+        }
+    }
+
+    // One displacement per enemy, however many fields reached it
+    for (std::size_t item : touched_) {
+        float dx = displaceX_[item];
+        float dy = displaceY_[item];
+        displaceX_[item] = 0.0f;
+        displaceY_[item] = 0.0f;
+        if (dx != 0.0f || dy != 0.0f) {
+            grid.getEnemy(item)->displace(sf::Vector2f(dx, dy));
+        }
+    }
+    touched_.clear();
+}
+
+void ForceFieldSystem::draw(sf::RenderWindow& window) const {
+    std::size_t count = fieldX_.size();
+    if (count == 0) return;
+
+    // Each field is a fan: dark core, tinted rim that fades as it expires
+    vertices_.resize(count * FIELD_SEGMENTS * 3);
+    std::size_t v = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vector2f center(fieldX_[i], fieldY_[i]);
+        float radius = fieldRadius_[i];
+        float life = fieldRemaining_[i] / fieldDuration_[i];
+        bool attractor = fieldStrength_[i] > 0.0f;
+
+        sf::Color coreColor = attractor ? sf::Color(10, 0, 20, 200) : sf::Color(200, 220, 255, 60);
+        sf::Color rimColor = attractor ? sf::Color(140, 60, 255, 0) : sf::Color(120, 180, 255, 0);
+        coreColor.a = static_cast<sf::Uint8>(coreColor.a * life);
+
+        for (int s = 0; s < FIELD_SEGMENTS; ++s) {
+            float a0 = 2.0f * PI * s / FIELD_SEGMENTS;
+            float a1 = 2.0f * PI * (s + 1) / FIELD_SEGMENTS;
+            vertices_[v].position = center;
+            vertices_[v].color = coreColor;
+            vertices_[v + 1].position = center + sf::Vector2f(std::cos(a0) * radius, std::sin(a0) * radius);
+            vertices_[v + 1].color = rimColor;
+            vertices_[v + 2].position = center + sf::Vector2f(std::cos(a1) * radius, std::sin(a1) * radius);
+            vertices_[v + 2].color = rimColor;
+            v += 3;
+        }
+    }
+
+    window.draw(vertices_);
+}
+
+void ForceFieldSystem::clear() {
+    fieldX_.clear();
+    fieldY_.clear();
+    fieldRadius_.clear();
+    fieldStrength_.clear();
+    fieldRemaining_.clear();
+    fieldDuration_.clear();
+    fieldCollapseDamage_.clear();
+}
+
+void ForceFieldSystem::remove(std::size_t index) {
+    std::size_t last = fieldX_.size() - 1;
+    fieldX_[index] = fieldX_[last];
+    fieldY_[index] = fieldY_[last];
+    fieldRadius_[index] = fieldRadius_[last];
+    fieldStrength_[index] = fieldStrength_[last];
+    fieldRemaining_[index] = fieldRemaining_[last];
+    fieldDuration_[index] = fieldDuration_[last];
+    fieldCollapseDamage_[index] = fieldCollapseDamage_[last];
+
+    fieldX_.pop_back();
+    fieldY_.pop_back();
+    fieldRadius_.pop_back();
+    fieldStrength_.pop_back();
+    fieldRemaining_.pop_back();
+    fieldDuration_.pop_back();
+    fieldCollapseDamage_.pop_back();
+}
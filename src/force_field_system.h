@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class SpatialGrid;
+
+// Gravity wells and repulsors. Each field pulls (strength > 0) or pushes
+// (strength < 0) enemies inside its radius, strongest at the centre. All
+// fields are applied in one batched pass after enemies have moved: the grid
+// supplies candidates, their positions are gathered into flat arrays, the
+// forces are computed in a branch-free loop and summed per enemy, and each
+// enemy is displaced once.
+class ForceFieldSystem {
+public:
+    static ForceFieldSystem& getInstance();
+
+    // strength is the pull speed in px/s at the centre. A field with
+    // collapseDamage > 0 ends in a blast through ExplosionSystem.
+    void spawn(const sf::Vector2f& center, float radius, float strength, float duration, int collapseDamage = 0);
+
+    void update(float deltaTime, const SpatialGrid& grid);
+
+    // Single draw call for all fields
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getActiveCount() const { return fieldX_.size(); }
+
+private:
+    ForceFieldSystem();
+
+    void applyForces(float deltaTime, const SpatialGrid& grid);
+    void remove(std::size_t index);
+
+    // Fields
+    std::vector<float> fieldX_;
+    std::vector<float> fieldY_;
+    std::vector<float> fieldRadius_;
+    std::vector<float> fieldStrength_;
+    std::vector<float> fieldRemaining_;
+    std::vector<float> fieldDuration_;
+    std::vector<int> fieldCollapseDamage_;
+
+    // Per-field candidate gather, reused every pass
+    std::vector<std::size_t> candidateItem_;
+    std::vector<float> candidateX_;
+    std::vector<float> candidateY_;
+    std::vector<float> candidateDX_;
+    std::vector<float> candidateDY_;
+
+    // Summed displacement per grid item and the items touched this pass
+    std::vector<float> displaceX_;
+    std::vector<float> displaceY_;
+    std::vector<std::size_t> touched_;
+
+    mutable sf::VertexArray vertices_;
+};
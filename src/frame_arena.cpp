@@ -0,0 +1,60 @@
+#include "frame_arena.h"
+#include "config.h"
+#include "log.h"
+#include <cstdint>
+
+FrameArena& FrameArena::getInstance() {
+    static FrameArena instance(static_cast<std::size_t>(Config::FRAME_ARENA_SIZE));
+    return instance;
+}
+
+FrameArena::FrameArena(std::size_t capacity) :
+    buffer_(new unsigned char[capacity]),
+    capacity_(capacity),
+    offset_(0),
+    lastFrameBytes_(0),
+    highWaterMark_(0),
+    overflowReported_(false) {
+}
+
+void FrameArena::reset() {
+    lastFrameBytes_ = offset_;
+    offset_ = 0;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+    std::uintptr_t aligned = (base + offset_ + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    std::size_t end = static_cast<std::size_t>(aligned - base) + bytes;
+
+    if (end > capacity_) {
+        // Out of frame memory: stay correct by going to the heap
+        if (!overflowReported_) {
+            LOG_WARNING("Frame arena exhausted (%zu bytes); raise Config::FRAME_ARENA_SIZE", capacity_);
+            overflowReported_ = true;
+        }
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    offset_ = end;
+    if (offset_ > highWaterMark_) {
+        highWaterMark_ = offset_;
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    // Arena memory is reclaimed all at once by reset()
+    if (!owns(p)) {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+bool FrameArena::owns(const void* p) const {
+    const unsigned char* bytes = static_cast<const unsigned char*>(p);
+    return bytes >= buffer_.get() && bytes < buffer_.get() + capacity_;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Bump allocator for data that only lives for one tick. Allocation is a
+// pointer increment, deallocation is a no-op and main.cpp rewinds the whole
+// arena after each frame. Hand it to std::pmr containers:
+//
+//     std::pmr::vector<int> scratch(&FrameArena::getInstance());
+//
+// Everything allocated from it must be destroyed before the frame ends.
+// Game thread only.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static FrameArena& getInstance();
+
+    explicit FrameArena(std::size_t capacity);
+
+    // Rewind to empty; called once per tick after the frame is presented
+    void reset();
+
+    std::size_t getCapacity() const { return capacity_; }
+    std::size_t getUsedBytes() const { return offset_; }
+    std::size_t getLastFrameBytes() const { return lastFrameBytes_; }
+    std::size_t getHighWaterMark() const { return highWaterMark_; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    std::unique_ptr<unsigned char[]> buffer_;
+    std::size_t capacity_;
+    std::size_t offset_;
+    std::size_t lastFrameBytes_;
+    std::size_t highWaterMark_;
+    bool overflowReported_;
+
+    bool owns(const void* p) const;
+};
@@ -0,0 +1,144 @@
+#include "frame_pacer.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+namespace {
+    // How early to stop sleeping and start spinning. Timers that can
+    // oversleep by a whole scheduler tick need a bigger margin.
+    constexpr std::chrono::microseconds PRECISE_SPIN_MARGIN(1000);
+    constexpr std::chrono::microseconds COARSE_SPIN_MARGIN(16000);
+    constexpr float REFRESH_SMOOTHING = 0.02f;
+}
+
+FramePacer::FramePacer(PacingMode mode, float targetFps)
+    : mode_(mode),
+      period_(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / std::max(targetFps, 1.0f)))),
+      spinMargin_(PRECISE_SPIN_MARGIN),
+      history_(),
+      historyCount_(0),
+      historyNext_(0),
+      refreshIntervalMs_(0.0f),
+      timerHandle_(nullptr) {
+#ifdef _WIN32
+    // Sleep() is only as fine as the system tick (often 15.6 ms); the
+    // high-resolution timer exists from Windows 10 1803 onwards
+    timerHandle_ = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!timerHandle_) {
+        spinMargin_ = COARSE_SPIN_MARGIN;
+    }
+#endif
+    lastFrame_ = Clock::now();
+    deadline_ = lastFrame_ + period_;
+}
+
+FramePacer::~FramePacer() {
+#ifdef _WIN32
+    if (timerHandle_) {
+        CloseHandle(static_cast<HANDLE>(timerHandle_));
+    }
+#endif
+}
+
+void FramePacer::configure(sf::RenderWindow& window) {
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(mode_ == PacingMode::VSYNC);
+    lastFrame_ = Clock::now();
+    deadline_ = lastFrame_ + period_;
+}
+
+const char* FramePacer::getModeName() const {
+    switch (mode_) {
+        case PacingMode::CAPPED: return "capped";
+        case PacingMode::VSYNC: return "vsync";
+        case PacingMode::UNCAPPED: return "uncapped";
+    }
+    return "unknown";
+}
+
+float FramePacer::beginFrame() {
+    Clock::time_point now = Clock::now();
+    float intervalMs = std::chrono::duration<float, std::milli>(now - lastFrame_).count();
+    lastFrame_ = now;
+    record(intervalMs);
+    return intervalMs / 1000.0f;
+}
+
+void FramePacer::waitForNextFrame() {
+    if (mode_ != PacingMode::CAPPED) return;
+
+    Clock::time_point now = Clock::now();
+    if (now > deadline_ + period_) {
+        // A long stall (loading, window drag): start a fresh schedule rather
+        // than rushing frames out to catch up
+        deadline_ = now;
+    } else {
+        Clock::duration remaining = deadline_ - now;
+        if (remaining > spinMargin_) {
+            sleepFor(remaining - spinMargin_);
+        }
+        while (Clock::now() < deadline_) {
+            std::this_thread::yield();
+        }
+    }
+    deadline_ += period_;
+}
+
+void FramePacer::sleepFor(Clock::duration duration) {
+#ifdef _WIN32
+    if (timerHandle_) {
+        // Relative due time in 100 ns units, negative
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -static_cast<LONGLONG>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / 100);
+        if (SetWaitableTimer(static_cast<HANDLE>(timerHandle_), &dueTime, 0, nullptr, nullptr, FALSE)) {
+            WaitForSingleObject(static_cast<HANDLE>(timerHandle_), INFINITE);
+            return;
+        }
+    }
+#endif
+    std::this_thread::sleep_for(duration);
+}
+
+void FramePacer::record(float intervalMs) {
+    history_[historyNext_] = intervalMs;
+    historyNext_ = (historyNext_ + 1) % HISTORY_SIZE;
+    historyCount_ = std::min(historyCount_ + 1, HISTORY_SIZE);
+
+    int window = std::min(historyCount_, std::min(Config::FRAME_PACER_STATS_FRAMES, HISTORY_SIZE));
+    float sum = 0.0f;
+    float worst = 0.0f;
+    for (int i = 0; i < window; ++i) {
+        float value = history_[(historyNext_ - 1 - i + HISTORY_SIZE) % HISTORY_SIZE];
+        sum += value;
+        worst = std::max(worst, value);
+    }
+    float mean = sum / window;
+    float variance = 0.0f;
+    for (int i = 0; i < window; ++i) {
+        float delta = history_[(historyNext_ - 1 - i + HISTORY_SIZE) % HISTORY_SIZE] - mean;
+        variance += delta * delta;
+    }
+    stats_.meanMs = mean;
+    stats_.jitterMs = std::sqrt(variance / window);
+    stats_.worstMs = worst;
+
+    // Under vsync, frames that make the deadline all take one refresh
+    // interval; only those (not missed frames) feed the estimate
+    if (mode_ == PacingMode::VSYNC) {
+        if (refreshIntervalMs_ <= 0.0f) {
+            refreshIntervalMs_ = intervalMs;
+        } else if (intervalMs < refreshIntervalMs_ * 1.5f) {
+            refreshIntervalMs_ += (intervalMs - refreshIntervalMs_) * REFRESH_SMOOTHING;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <chrono>
+
+enum class PacingMode {
+    CAPPED,    // Sleep to a fixed rate, then spin the last stretch for precision
+    VSYNC,     // Let the driver block in display(); the refresh rate is measured
+    UNCAPPED   // No waiting at all, for benchmarking
+};
+
+// Frame interval statistics over the last Config::FRAME_PACER_STATS_FRAMES frames
+struct FramePacingStats {
+    float meanMs = 0.0f;
+    float jitterMs = 0.0f;   // Standard deviation of the interval
+    float worstMs = 0.0f;
+};
+
+// Replaces setFramerateLimit, whose plain sleep wakes up late by up to a
+// scheduler tick and feeds that jitter straight into deltaTime. Deadlines
+// are absolute, so an early or late frame doesn't shift the ones after it.
+//
+// Per frame: deltaTime = beginFrame(); ...update and draw...; display();
+// waitForNextFrame().
+class FramePacer {
+public:
+    FramePacer(PacingMode mode, float targetFps);
+    ~FramePacer();
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // Set up the window's own limiter and vsync to match the mode
+    void configure(sf::RenderWindow& window);
+
+    // Seconds since the previous beginFrame(); also records the interval
+    float beginFrame();
+
+    // Block until the next frame is due (CAPPED only)
+    void waitForNextFrame();
+
+    PacingMode getMode() const { return mode_; }
+    const char* getModeName() const;
+    const FramePacingStats& getStats() const { return stats_; }
+
+    // Display rate estimated from measured intervals; only meaningful in VSYNC mode
+    float getMeasuredRefreshHz() const { return refreshIntervalMs_ > 0.0f ? 1000.0f / refreshIntervalMs_ : 0.0f; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void record(float intervalMs);
+    void sleepFor(Clock::duration duration);
+
+    PacingMode mode_;
+    Clock::duration period_;
+    Clock::duration spinMargin_;  // Wake this long before the deadline and spin
+    Clock::time_point lastFrame_;
+    Clock::time_point deadline_;
+
+    // Ring of recent intervals for the statistics
+    static constexpr int HISTORY_SIZE = 256;
+    float history_[HISTORY_SIZE];
+    int historyCount_;
+    int historyNext_;
+    FramePacingStats stats_;
+    float refreshIntervalMs_;
+
+    void* timerHandle_;  // High-resolution waitable timer on Windows, unused elsewhere
+};
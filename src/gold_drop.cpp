@@ -1,5 +1,7 @@
 #include "gold_drop.h"
+#include "asset_bundle.h"
 #include "player.h"
+#include "render_queue.h"
 #include "config.h"
 #include <cmath>
 
@@ -16,7 +18,7 @@ GoldDrop::GoldDrop(const sf::Vector2f& position, int value)
     shape_.setPosition(position_);
     
     // Initialize text
-    if (font_.loadFromFile("ARIAL.TTF")) {
+    if (loadFontAsset(font_, "assets/ARIAL.TTF")) {
         valueText_.setFont(font_);
         valueText_.setString(std::to_string(value_));
         valueText_.setCharacterSize(12);
@@ -64,11 +66,13 @@ void GoldDrop::update(float deltaTime) {
     }
 }
 
-void GoldDrop::draw(sf::RenderWindow& window) const {
+void GoldDrop::submit(RenderQueue& queue) const {
     if (!active_) return;
     
-    window.draw(shape_);
-    window.draw(valueText_);
+    // Shared sort key keeps the label on top of its coin
+    float sortY = position_.y + baseRadius_;
+    queue.submit(shape_, sortY, RenderLayer::ACTORS);
+    queue.submit(valueText_, sortY, RenderLayer::ACTORS);
 }
 
 bool GoldDrop::checkCollision(const Player& player) {
@@ -2,13 +2,14 @@
 #include <SFML/Graphics.hpp>
 
 class Player;
+class RenderQueue;
 
 class GoldDrop {
 public:
     GoldDrop(const sf::Vector2f& position, int value);
     
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window) const;
+    void submit(RenderQueue& queue) const;
     bool checkCollision(const Player& player);
     bool isActive() const { return active_; }
     int getValue() const { return value_; }
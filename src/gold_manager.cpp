@@ -1,5 +1,6 @@
 #include "gold_manager.h"
 #include "player.h"
+#include "particle_system.h"
 #include <algorithm>
 
 GoldManager::GoldManager() {
@@ -13,6 +14,7 @@ void GoldManager::update(float deltaTime, Player& player) {
         // Check for collection
         if (gold->checkCollision(player)) {
             player.addGold(gold->getValue());
+            ParticleSystem::getInstance().emitPickup(gold->getPosition(), sf::Color(255, 215, 0));
         }
     }
     
@@ -20,9 +22,11 @@ void GoldManager::update(float deltaTime, Player& player) {
     removeInactiveGold();
 }
 
-void GoldManager::draw(sf::RenderWindow& window) const {
+void GoldManager::submit(RenderQueue& queue, const sf::FloatRect& visibleArea) const {
     for (const auto& gold : goldDrops_) {
-        gold->draw(window);
+        if (visibleArea.contains(gold->getPosition())) {
+            gold->submit(queue);
+        }
     }
 }
 
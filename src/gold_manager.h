@@ -5,13 +5,14 @@
 #include "gold_drop.h"
 
 class Player;
+class RenderQueue;
 
 class GoldManager {
 public:
     GoldManager();
     
     void update(float deltaTime, Player& player);
-    void draw(sf::RenderWindow& window) const;
+    void submit(RenderQueue& queue, const sf::FloatRect& visibleArea) const;
     void spawnGold(const sf::Vector2f& position, int value);
     void clear();
     
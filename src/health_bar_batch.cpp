@@ -0,0 +1,54 @@
+#include "health_bar_batch.h"
+#include <algorithm>
+
+namespace {
+    constexpr float BAR_WIDTH = 40.0f;
+    constexpr float BAR_HEIGHT = 6.0f;
+    constexpr float OUTLINE = 1.0f;
+    constexpr float FILL_INSET = 1.0f;
+    constexpr std::size_t INITIAL_BARS = 512;
+}
+
+HealthBarBatch& HealthBarBatch::getInstance() {
+    static HealthBarBatch instance;
+    return instance;
+}
+
+HealthBarBatch::HealthBarBatch() : vertices_(sf::Quads) {
+    // Size the array once so typical frames never grow it
+    vertices_.resize(INITIAL_BARS * VERTICES_PER_BAR);
+    vertices_.clear();
+}
+
+void HealthBarBatch::begin() {
+    vertices_.clear();
+}
+
+void HealthBarBatch::add(const sf::Vector2f& center, float fraction) {
+    fraction = std::min(std::max(fraction, 0.0f), 1.0f);
+    float left = center.x - BAR_WIDTH / 2.0f;
+    float top = center.y;
+
+    // Green above 60%, yellow above 30%, red below
+    sf::Color fillColor = fraction > 0.6f ? sf::Color::Green
+                        : fraction > 0.3f ? sf::Color::Yellow
+                        : sf::Color::Red;
+
+    appendQuad(left - OUTLINE, top - OUTLINE, BAR_WIDTH + 2.0f * OUTLINE, BAR_HEIGHT + 2.0f * OUTLINE,
+               sf::Color::Black);
+    appendQuad(left, top, BAR_WIDTH, BAR_HEIGHT, sf::Color(50, 50, 50, 200));
+    appendQuad(left + FILL_INSET, top + FILL_INSET, (BAR_WIDTH - 2.0f * FILL_INSET) * fraction,
+               BAR_HEIGHT - 2.0f * FILL_INSET, fillColor);
+}
+
+void HealthBarBatch::appendQuad(float left, float top, float width, float height, const sf::Color& color) {
+    vertices_.append(sf::Vertex(sf::Vector2f(left, top), color));
+    vertices_.append(sf::Vertex(sf::Vector2f(left + width, top), color));
+    vertices_.append(sf::Vertex(sf::Vector2f(left + width, top + height), color));
+    vertices_.append(sf::Vertex(sf::Vector2f(left, top + height), color));
+}
+
+void HealthBarBatch::draw(sf::RenderWindow& window) const {
+    if (vertices_.getVertexCount() == 0) return;
+    window.draw(vertices_);
+}
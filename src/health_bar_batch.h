@@ -0,0 +1,29 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Collects the health bars of every damaged enemy drawn this frame and
+// submits them as one vertex array, instead of two shape draws per enemy.
+// Usage per frame: begin(), add() for each bar, then draw().
+class HealthBarBatch {
+public:
+    static HealthBarBatch& getInstance();
+
+    void begin();
+
+    // Bar centred horizontally on center.x with its top edge at center.y;
+    // fraction is remaining health in [0, 1]
+    void add(const sf::Vector2f& center, float fraction);
+
+    void draw(sf::RenderWindow& window) const;
+
+    std::size_t getCount() const { return vertices_.getVertexCount() / VERTICES_PER_BAR; }
+
+private:
+    HealthBarBatch();
+
+    static constexpr std::size_t VERTICES_PER_BAR = 12;  // Outline, background, fill
+
+    void appendQuad(float left, float top, float width, float height, const sf::Color& color);
+
+    sf::VertexArray vertices_;
+};
@@ -1,7 +1,9 @@
 #include "health_pack.h"
+#include "log.h"
 #include "player.h"
+#include "render_queue.h"
+#include "texture_cache.h"
 #include <cmath>
-#include <iostream>
 
 HealthPack::HealthPack(const sf::Vector2f& position) :
     worldPosition(position),
@@ -10,31 +12,41 @@ HealthPack::HealthPack(const sf::Vector2f& position) :
     bobTimer(0.0f),
     bobAmount(5.0f),
     hasTexture(false) {
+    texture = nullptr;
     
-    std::cout << "Creating health pack at position: (" << position.x << ", " << position.y << ")" << std::endl;
+    LOG_DEBUG("Creating health pack at position: (%.1f, %.1f)", position.x, position.y);
     loadVisuals();
 }
 
 void HealthPack::loadVisuals() {
     // Try to load health pack texture
-    if (texture.loadFromFile("assets/textures/health_pack.png")) {
+    texture = TextureCache::getInstance().get("assets/textures/health_pack.png");
+    if (texture) {
         hasTexture = true;
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         
         // Center the origin
         sf::FloatRect bounds = sprite.getLocalBounds();
         sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
         sprite.setScale(0.8f, 0.8f); // Scale down a bit
         
-        std::cout << "Health pack texture loaded successfully" << std::endl;
+        LOG_DEBUG("Health pack texture loaded successfully");
     } else {
         // Fallback to a green cross shape
         hasTexture = false;
         fallbackShape.setSize(sf::Vector2f(20.f, 20.f));
         fallbackShape.setFillColor(sf::Color::Green);
         fallbackShape.setOrigin(10.f, 10.f);
+
+        // Draw a simple cross pattern for the health pack
+        crossHorizontal.setSize(sf::Vector2f(16.f, 4.f));
+        crossHorizontal.setOrigin(8.f, 2.f);
+        crossHorizontal.setFillColor(sf::Color::White);
+        crossVertical.setSize(sf::Vector2f(4.f, 16.f));
+        crossVertical.setOrigin(2.f, 8.f);
+        crossVertical.setFillColor(sf::Color::White);
         
-        std::cout << "Could not load health pack texture, using fallback shape" << std::endl;
+        LOG_WARNING("Could not load health pack texture, using fallback shape");
     }
     
     // Set initial position
@@ -42,6 +54,8 @@ void HealthPack::loadVisuals() {
         sprite.setPosition(worldPosition);
     } else {
         fallbackShape.setPosition(worldPosition);
+        crossHorizontal.setPosition(worldPosition);
+        crossVertical.setPosition(worldPosition);
     }
 }
 
@@ -65,45 +79,28 @@ void HealthPack::update(float deltaTime) {
         }
     } else {
         fallbackShape.setPosition(bobbingPosition);
+        crossHorizontal.setPosition(bobbingPosition);
+        crossVertical.setPosition(bobbingPosition);
         
         // Add a slight fade effect when near expiration
         if (lifetime < 5.0f) {
             sf::Uint8 alpha = static_cast<sf::Uint8>(255 * (lifetime / 5.0f));
             fallbackShape.setFillColor(sf::Color(0, 255, 0, alpha));
+            crossHorizontal.setFillColor(sf::Color(255, 255, 255, alpha));
+            crossVertical.setFillColor(sf::Color(255, 255, 255, alpha));
         }
     }
 }
 
-void HealthPack::draw(sf::RenderWindow& window) const {
+void HealthPack::submit(RenderQueue& queue) const {
     if (hasTexture) {
-        window.draw(sprite);
+        queue.submit(sprite, RenderLayer::ACTORS);
     } else {
-        window.draw(fallbackShape);
-        
-        // Draw a simple cross pattern for the health pack
-        sf::RectangleShape horizontalBar(sf::Vector2f(16.f, 4.f));
-        sf::RectangleShape verticalBar(sf::Vector2f(4.f, 16.f));
-        
-        sf::Vector2f pos = fallbackShape.getPosition();
-        
-        horizontalBar.setOrigin(8.f, 2.f);
-        verticalBar.setOrigin(2.f, 8.f);
-        
-        horizontalBar.setPosition(pos);
-        verticalBar.setPosition(pos);
-        
-        // Use white for the cross
-        sf::Color crossColor = sf::Color::White;
-        if (lifetime < 5.0f) {
-            sf::Uint8 alpha = static_cast<sf::Uint8>(255 * (lifetime / 5.0f));
-            crossColor.a = alpha;
-        }
-        
-        horizontalBar.setFillColor(crossColor);
-        verticalBar.setFillColor(crossColor);
-        
-        window.draw(horizontalBar);
-        window.draw(verticalBar);
+        // Same sort key for all three, so the cross stays on top of the box
+        float sortY = fallbackShape.getPosition().y + 10.f;
+        queue.submit(fallbackShape, sortY, RenderLayer::ACTORS);
+        queue.submit(crossHorizontal, sortY, RenderLayer::ACTORS);
+        queue.submit(crossVertical, sortY, RenderLayer::ACTORS);
     }
 }
 
@@ -2,21 +2,22 @@
 #include <SFML/Graphics.hpp>
 
 class Player;
+class RenderQueue;
 
 class HealthPack {
 public:
     HealthPack(const sf::Vector2f& position);
     
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window) const;
+    void submit(RenderQueue& queue) const;
     bool checkCollision(const Player& player) const;
     bool isExpired() const { return lifetime <= 0.0f; }
-    sf::Vector2f getPosition() const { return sprite.getPosition(); }
+    sf::Vector2f getPosition() const { return hasTexture ? sprite.getPosition() : fallbackShape.getPosition(); }
     int getHealAmount() const { return healAmount; }
     
 private:
     sf::Sprite sprite;
-    sf::Texture texture;
+    const sf::Texture* texture;  // Shared through TextureCache
     sf::Vector2f worldPosition;
     float lifetime; // Health pack disappears after some time
     int healAmount;
@@ -24,6 +25,8 @@ private:
     float bobAmount;
     bool hasTexture;
     sf::RectangleShape fallbackShape; // Fallback if texture fails to load
+    sf::RectangleShape crossHorizontal; // White cross drawn on the fallback
+    sf::RectangleShape crossVertical;
     
     void loadVisuals();
 }; 
\ No newline at end of file
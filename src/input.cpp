@@ -0,0 +1,58 @@
+#include "input.h"
+
+Input& Input::getInstance() {
+    static Input instance;
+    return instance;
+}
+
+void Input::beginFrame() {
+    snapshot_.keysPressed_.reset();
+    snapshot_.keysReleased_.reset();
+    snapshot_.buttonsPressed_.reset();
+    snapshot_.buttonsReleased_.reset();
+}
+
+void Input::handleEvent(const sf::Event& event) {
+    switch (event.type) {
+        case sf::Event::KeyPressed: {
+            sf::Keyboard::Key key = event.key.code;
+            if (!InputSnapshot::inRange(key)) break;
+            if (!snapshot_.keysDown_[key]) {
+                snapshot_.keysPressed_[key] = true;
+            }
+            snapshot_.keysDown_[key] = true;
+            break;
+        }
+        case sf::Event::KeyReleased: {
+            sf::Keyboard::Key key = event.key.code;
+            if (!InputSnapshot::inRange(key)) break;
+            if (snapshot_.keysDown_[key]) {
+                snapshot_.keysReleased_[key] = true;
+            }
+            snapshot_.keysDown_[key] = false;
+            break;
+        }
+        case sf::Event::MouseButtonPressed:
+            if (!snapshot_.buttonsDown_[event.mouseButton.button]) {
+                snapshot_.buttonsPressed_[event.mouseButton.button] = true;
+            }
+            snapshot_.buttonsDown_[event.mouseButton.button] = true;
+            break;
+        case sf::Event::MouseButtonReleased:
+            if (snapshot_.buttonsDown_[event.mouseButton.button]) {
+                snapshot_.buttonsReleased_[event.mouseButton.button] = true;
+            }
+            snapshot_.buttonsDown_[event.mouseButton.button] = false;
+            break;
+        case sf::Event::LostFocus:
+            // Releases that happen while unfocused never arrive; don't
+            // leave keys stuck down
+            snapshot_.keysReleased_ |= snapshot_.keysDown_;
+            snapshot_.buttonsReleased_ |= snapshot_.buttonsDown_;
+            snapshot_.keysDown_.reset();
+            snapshot_.buttonsDown_.reset();
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include <bitset>
+
+// Keyboard and mouse state for one frame, built from the event stream.
+// Consumers only ever see it as const, so everything in a frame reads the
+// same input, and a run fed the same events behaves the same way.
+//
+// isDown is the held state; wasPressed/wasReleased are edges that are true
+// for exactly one frame. Key repeat events don't count as new presses.
+class InputSnapshot {
+public:
+    bool isDown(sf::Keyboard::Key key) const { return inRange(key) && keysDown_[key]; }
+    bool wasPressed(sf::Keyboard::Key key) const { return inRange(key) && keysPressed_[key]; }
+    bool wasReleased(sf::Keyboard::Key key) const { return inRange(key) && keysReleased_[key]; }
+
+    bool isDown(sf::Mouse::Button button) const { return buttonsDown_[button]; }
+    bool wasPressed(sf::Mouse::Button button) const { return buttonsPressed_[button]; }
+    bool wasReleased(sf::Mouse::Button button) const { return buttonsReleased_[button]; }
+
+private:
+    friend class Input;
+
+    static bool inRange(sf::Keyboard::Key key) { return key >= 0 && key < sf::Keyboard::KeyCount; }
+
+    std::bitset<sf::Keyboard::KeyCount> keysDown_;
+    std::bitset<sf::Keyboard::KeyCount> keysPressed_;
+    std::bitset<sf::Keyboard::KeyCount> keysReleased_;
+    std::bitset<sf::Mouse::ButtonCount> buttonsDown_;
+    std::bitset<sf::Mouse::ButtonCount> buttonsPressed_;
+    std::bitset<sf::Mouse::ButtonCount> buttonsReleased_;
+};
+
+// Owns the snapshot. Per frame: beginFrame(), handleEvent() for every
+// polled event, then hand getSnapshot() to the consumers. Replaces direct
+// sf::Keyboard polling, which is a round trip to the window system per call.
+class Input {
+public:
+    static Input& getInstance();
+
+    // Clear last frame's edges; held keys carry over
+    void beginFrame();
+    void handleEvent(const sf::Event& event);
+
+    const InputSnapshot& getSnapshot() const { return snapshot_; }
+
+private:
+    Input() = default;
+
+    InputSnapshot snapshot_;
+};
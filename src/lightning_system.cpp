@@ -0,0 +1,152 @@
+#include "lightning_system.h"
+#include "enemy.h"
+#include "player.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float ARC_DURATION = 0.2f;
+    constexpr float ARC_WIDTH = 3.0f;
+}
+
+LightningSystem& LightningSystem::getInstance() {
+    static LightningSystem instance;
+    return instance;
+}
+
+LightningSystem::LightningSystem() : stamp_(0), vertices_(sf::Quads) {
+}
+
+int LightningSystem::strike(const sf::Vector2f& origin, float reach, float jumpRadius, int maxHops, int damage,
+                            float damageFalloff, const sf::Color& color, const SpatialGrid& grid, Player* player) {
+    if (itemStamp_.size() < grid.getItemCount()) {
+        itemStamp_.resize(grid.getItemCount(), 0);
+    }
+    if (++stamp_ == 0) {
+        // Wrapped around; old stamps could collide
+        std::fill(itemStamp_.begin(), itemStamp_.end(), 0);
+        stamp_ = 1;
+    }
+
+    auto unhit = [&](std::size_t item) {
+        return itemStamp_[item] != stamp_ && grid.getEnemy(item)->isAlive();
+    };
+
+    sf::Vector2f from = origin;
+    float radius = reach;
+    float hopDamage = static_cast<float>(damage);
+    int hits = 0;
+
+    for (int hop = 0; hop <= maxHops; ++hop) {
+        long item = grid.findNearestWrapped(from, radius, unhit);
+        if (item < 0) break;
+
+        itemStamp_[item] = stamp_;
+        Enemy* enemy = grid.getEnemy(static_cast<std::size_t>(item));
+        int baseDamage = std::max(1, static_cast<int>(hopDamage + 0.5f));
+        bool critical = false;
+        int modifiedDamage = player ? player->calculateModifiedDamage(baseDamage, &critical) : baseDamage;
+        enemy->takeDamage(modifiedDamage, critical);
+        if (player) {
+            player->applyLifeSteal(modifiedDamage);
+        }
+        ++hits;
+
+        // The hop may cross the world's edge; draw it the short way
+        sf::Vector2f to = grid.getPosition(static_cast<std::size_t>(item));
+        addArc(from, from + wrappedDelta(from, to), color);
+
+        from = to;
+        radius = jumpRadius;
+        hopDamage *= 1.0f - damageFalloff;
+    }
+
+    return hits;
+}
+
+void LightningSystem::addArc(const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& color) {
+    arcStartX_.push_back(from.x);
+    arcStartY_.push_back(from.y);
+    arcEndX_.push_back(to.x);
+    arcEndY_.push_back(to.y);
+    arcAge_.push_back(0.0f);
+    arcColor_.push_back(color);
+}
+
+void LightningSystem::update(float deltaTime) {
+    std::size_t i = 0;
+    while (i < arcAge_.size()) {
+        arcAge_[i] += deltaTime;
+        if (arcAge_[i] < ARC_DURATION) {
+            ++i;
+            continue;
+        }
+
+        // Swap-remove faded arcs
+        std::size_t last = arcAge_.size() - 1;
+        arcStartX_[i] = arcStartX_[last];
+        arcStartY_[i] = arcStartY_[last];
+        arcEndX_[i] = arcEndX_[last];
+        arcEndY_[i] = arcEndY_[last];
+        arcAge_[i] = arcAge_[last];
+        arcColor_[i] = arcColor_[last];
+        arcStartX_.pop_back();
+        arcStartY_.pop_back();
+        arcEndX_.pop_back();
+        arcEndY_.pop_back();
+        arcAge_.pop_back();
+        arcColor_.pop_back();
+    }
+}
+
+void LightningSystem::draw(sf::RenderWindow& window) const {
+    std::size_t count = arcAge_.size();
+    if (count == 0) return;
+
+    // Each arc is two quads with a kinked midpoint so it reads as lightning
+    vertices_.resize(count * 8);
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vector2f start(arcStartX_[i], arcStartY_[i]);
+        sf::Vector2f end(arcEndX_[i], arcEndY_[i]);
+        sf::Vector2f along = end - start;
+        float length = std::sqrt(along.x * along.x + along.y * along.y);
+        sf::Vector2f normal(0.0f, 0.0f);
+        if (length > 0.0f) {
+            normal = sf::Vector2f(-along.y, along.x) / length;
+        }
+
+        // Kink alternates side per arc; cheap and stable frame to frame
+        float kink = (i % 2 == 0 ? 0.15f : -0.15f) * length;
+        sf::Vector2f middle = start + along * 0.5f + normal * kink;
+        sf::Vector2f side = normal * (ARC_WIDTH * 0.5f);
+
+        sf::Color color = arcColor_[i];
+        color.a = static_cast<sf::Uint8>(color.a * (1.0f - arcAge_[i] / ARC_DURATION));
+
+        sf::Vertex* quad = &vertices_[i * 8];
+        quad[0].position = start + side;
+        quad[1].position = middle + side;
+        quad[2].position = middle - side;
+        quad[3].position = start - side;
+        quad[4].position = middle + side;
+        quad[5].position = end + side;
+        quad[6].position = end - side;
+        quad[7].position = middle - side;
+        for (int v = 0; v < 8; ++v) {
+            quad[v].color = color;
+        }
+    }
+
+    window.draw(vertices_);
+}
+
+void LightningSystem::clear() {
+    arcStartX_.clear();
+    arcStartY_.clear();
+    arcEndX_.clear();
+    arcEndY_.clear();
+    arcAge_.clear();
+    arcColor_.clear();
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+class Player;
+class SpatialGrid;
+
+// Chain lightning. A strike hits the enemy nearest the origin, then hops to
+// the nearest enemy it hasn't hit yet within the jump radius, and so on.
+// Each hop is a ring search over the enemy grid, so a chain costs a few
+// cells per hop rather than a scan of every enemy. Arcs fade out over a
+// short time and are drawn with one call.
+class LightningSystem {
+public:
+    static LightningSystem& getInstance();
+
+    // Damage drops by damageFalloff (0..1) per hop. Returns the number of
+    // enemies hit, including the first.
+    int strike(const sf::Vector2f& origin, float reach, float jumpRadius, int maxHops, int damage,
+               float damageFalloff, const sf::Color& color, const SpatialGrid& grid, Player* player = nullptr);
+
+    // Fade out visible arcs
+    void update(float deltaTime);
+
+    // Single draw call for all visible arcs
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getActiveCount() const { return arcAge_.size(); }
+
+private:
+    LightningSystem();
+
+    void addArc(const sf::Vector2f& from, const sf::Vector2f& to, const sf::Color& color);
+
+    // Marks grid items already hit by the current strike
+    std::vector<std::uint32_t> itemStamp_;
+    std::uint32_t stamp_;
+
+    // Visible arcs
+    std::vector<float> arcStartX_;
+    std::vector<float> arcStartY_;
+    std::vector<float> arcEndX_;
+    std::vector<float> arcEndY_;
+    std::vector<float> arcAge_;
+    std::vector<sf::Color> arcColor_;
+
+    mutable sf::VertexArray vertices_;
+};
@@ -0,0 +1,183 @@
+#include "log.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <thread>
+
+namespace {
+    constexpr std::size_t RING_CAPACITY = 1024; // Must be a power of two
+    constexpr std::size_t MESSAGE_LENGTH = 240;
+
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        LogLevel level;
+        double timestamp;
+        char text[MESSAGE_LENGTH];
+    };
+
+    // Bounded multi-producer queue; each slot's sequence number tells producers
+    // and the consumer whose turn it is, so no locks are needed.
+    class Logger {
+    public:
+        Logger() : enqueuePos_(0), dequeuePos_(0), dropped_(0), running_(false), file_(nullptr) {
+            for (std::size_t i = 0; i < RING_CAPACITY; ++i) {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool start(const char* filename) {
+            if (running_.load()) {
+                return true;
+            }
+            file_ = std::fopen(filename, "w");
+            if (!file_) {
+                return false;
+            }
+            epoch_ = std::chrono::steady_clock::now();
+            running_.store(true);
+            writer_ = std::thread(&Logger::run, this);
+            return true;
+        }
+
+        void stop() {
+            if (!running_.exchange(false)) {
+                return;
+            }
+            writer_.join();
+            drain();
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+
+        void write(LogLevel level, const char* format, va_list args) {
+            if (!running_.load(std::memory_order_relaxed)) {
+                // No writer yet (startup, tools): print directly
+                std::fprintf(stderr, "[%s] ", levelName(level));
+                std::vfprintf(stderr, format, args);
+                std::fputc('\n', stderr);
+                return;
+            }
+
+            Slot* slot = claimSlot();
+            if (!slot) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            slot->level = level;
+            slot->timestamp = std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch_).count();
+            std::vsnprintf(slot->text, MESSAGE_LENGTH, format, args);
+            publishSlot(slot);
+        }
+
+        std::uint64_t getDroppedCount() const {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<Slot, RING_CAPACITY> slots_;
+        alignas(64) std::atomic<std::size_t> enqueuePos_;
+        alignas(64) std::size_t dequeuePos_; // Only touched by the writer
+        std::atomic<std::uint64_t> dropped_;
+        std::atomic<bool> running_;
+        std::FILE* file_;
+        std::thread writer_;
+        std::chrono::steady_clock::time_point epoch_;
+
+        static const char* levelName(LogLevel level) {
+            switch (level) {
+                case LogLevel::TRACE: return "TRACE";
+                case LogLevel::DEBUG: return "DEBUG";
+                case LogLevel::INFO: return "INFO";
+                case LogLevel::WARNING: return "WARNING";
+                case LogLevel::ERROR: return "ERROR";
+                default: return "LOG";
+            }
+        }
+
+        Slot* claimSlot() {
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& slot = slots_[pos & (RING_CAPACITY - 1)];
+                std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        return &slot;
+                    }
+                } else if (diff < 0) {
+                    return nullptr; // Full
+                } else {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void publishSlot(Slot* slot) {
+            // A claimed slot's sequence equals its position; +1 marks it readable
+            std::size_t pos = slot->sequence.load(std::memory_order_relaxed);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+        }
+
+        // Write out everything currently published; returns number written
+        std::size_t drain() {
+            std::size_t written = 0;
+            for (;;) {
+                Slot& slot = slots_[dequeuePos_ & (RING_CAPACITY - 1)];
+                std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != dequeuePos_ + 1) {
+                    break;
+                }
+
+                std::fprintf(file_, "[%10.3f] %-7s %s\n", slot.timestamp, levelName(slot.level), slot.text);
+                if (slot.level >= LogLevel::WARNING) {
+                    std::fprintf(stderr, "[%s] %s\n", levelName(slot.level), slot.text);
+                }
+
+                // Hand the slot back to producers for the next lap
+                slot.sequence.store(dequeuePos_ + RING_CAPACITY, std::memory_order_release);
+                ++dequeuePos_;
+                ++written;
+            }
+
+            if (written > 0) {
+                std::fflush(file_);
+            }
+            return written;
+        }
+
+        void run() {
+            while (running_.load(std::memory_order_relaxed)) {
+                if (drain() == 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                }
+            }
+        }
+    };
+
+    Logger& getLogger() {
+        static Logger logger;
+        return logger;
+    }
+}
+
+bool Log::start(const char* filename) {
+    return getLogger().start(filename);
+}
+
+void Log::stop() {
+    getLogger().stop();
+}
+
+void Log::write(LogLevel level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    getLogger().write(level, format, args);
+    va_end(args);
+}
+
+std::uint64_t Log::getDroppedCount() {
+    return getLogger().getDroppedCount();
+}
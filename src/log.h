@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+
+// Asynchronous logging. Call sites format into a lock-free ring buffer and a
+// background thread writes the messages to the log file, so the game thread
+// never blocks on console or disk I/O.
+
+enum class LogLevel {
+    TRACE = 0,
+    DEBUG = 1,
+    INFO = 2,
+    WARNING = 3,
+    ERROR = 4
+};
+
+// Messages below this level are removed at compile time
+#ifndef ESTATE_LOG_LEVEL
+#ifdef NDEBUG
+#define ESTATE_LOG_LEVEL 2
+#else
+#define ESTATE_LOG_LEVEL 1
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ESTATE_PRINTF_FORMAT(fmtIndex, argIndex) __attribute__((format(printf, fmtIndex, argIndex)))
+#else
+#define ESTATE_PRINTF_FORMAT(fmtIndex, argIndex)
+#endif
+
+class Log {
+public:
+    // Start the writer thread; until then messages go straight to stderr
+    static bool start(const char* filename);
+
+    // Drain pending messages and join the writer thread
+    static void stop();
+
+    // printf-style; never blocks, drops the message if the buffer is full
+    static void write(LogLevel level, const char* format, ...) ESTATE_PRINTF_FORMAT(2, 3);
+
+    static std::uint64_t getDroppedCount();
+};
+
+#if ESTATE_LOG_LEVEL <= 0
+#define LOG_TRACE(...) Log::write(LogLevel::TRACE, __VA_ARGS__)
+#else
+#define LOG_TRACE(...) ((void)0)
+#endif
+
+#if ESTATE_LOG_LEVEL <= 1
+#define LOG_DEBUG(...) Log::write(LogLevel::DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#if ESTATE_LOG_LEVEL <= 2
+#define LOG_INFO(...) Log::write(LogLevel::INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if ESTATE_LOG_LEVEL <= 3
+#define LOG_WARNING(...) Log::write(LogLevel::WARNING, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) ((void)0)
+#endif
+
+#define LOG_ERROR(...) Log::write(LogLevel::ERROR, __VA_ARGS__)
@@ -0,0 +1,196 @@
+#include "lz4_block.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+    constexpr std::size_t MIN_MATCH = 4;
+    constexpr std::size_t LAST_LITERALS = 5;   // Block must end in literals
+    constexpr std::size_t MF_LIMIT = 12;       // Last match starts this far from the end
+    constexpr std::size_t MAX_DISTANCE = 65535;
+    constexpr unsigned HASH_LOG = 16;
+    constexpr unsigned RUN_MASK = 15;
+
+    std::uint32_t read32(const unsigned char* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    std::size_t hashSequence(std::uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HASH_LOG);
+    }
+
+    // Lengths that overflow the token nibble continue in 255-byte steps
+    std::size_t writeLength(unsigned char* dst, std::size_t op, std::size_t length) {
+        while (length >= 255) {
+            dst[op++] = 255;
+            length -= 255;
+        }
+        dst[op++] = static_cast<unsigned char>(length);
+        return op;
+    }
+
+    bool readLength(const unsigned char* src, std::size_t srcSize, std::size_t& ip, std::size_t& length) {
+        unsigned char byte;
+        do {
+            if (ip >= srcSize) {
+                return false;
+            }
+            byte = src[ip++];
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    std::size_t writeSequence(unsigned char* dst, std::size_t op, const unsigned char* literals,
+                              std::size_t literalLength, std::size_t offset, std::size_t matchLength) {
+        std::size_t token = op++;
+        if (literalLength >= RUN_MASK) {
+            dst[token] = static_cast<unsigned char>(RUN_MASK << 4);
+            op = writeLength(dst, op, literalLength - RUN_MASK);
+        } else {
+            dst[token] = static_cast<unsigned char>(literalLength << 4);
+        }
+        if (literalLength > 0) {
+            std::memcpy(dst + op, literals, literalLength);
+        }
+        op += literalLength;
+
+        // A block's final sequence carries literals only
+        if (matchLength == 0) {
+            return op;
+        }
+
+        dst[op++] = static_cast<unsigned char>(offset & 0xFF);
+        dst[op++] = static_cast<unsigned char>(offset >> 8);
+
+        std::size_t extra = matchLength - MIN_MATCH;
+        if (extra >= RUN_MASK) {
+            dst[token] |= static_cast<unsigned char>(RUN_MASK);
+            op = writeLength(dst, op, extra - RUN_MASK);
+        } else {
+            dst[token] |= static_cast<unsigned char>(extra);
+        }
+        return op;
+    }
+}
+
+namespace Lz4 {
+    std::size_t compressBound(std::size_t srcSize) {
+        return srcSize + srcSize / 255 + 16;
+    }
+
+    std::size_t compress(const unsigned char* src, std::size_t srcSize,
+                         unsigned char* dst, std::size_t dstCapacity) {
+        if (dstCapacity < compressBound(srcSize)) {
+            return 0;
+        }
+
+        std::size_t anchor = 0;
+        std::size_t op = 0;
+
+        // Shorter inputs are stored as a single literal run
+        if (srcSize > MF_LIMIT) {
+            const std::size_t matchLimit = srcSize - LAST_LITERALS;
+            const std::size_t lastMatchStart = srcSize - MF_LIMIT;
+            std::vector<std::size_t> table(std::size_t(1) << HASH_LOG, 0);
+
+            std::size_t ip = 0;
+            while (ip <= lastMatchStart) {
+                std::uint32_t sequence = read32(src + ip);
+                std::size_t h = hashSequence(sequence);
+                std::size_t ref = table[h];
+                table[h] = ip;
+
+                if (ref >= ip || ip - ref > MAX_DISTANCE || read32(src + ref) != sequence) {
+                    // Step faster the longer we go without a match, so
+                    // noisy pixels don't cost a probe per byte
+                    ip += 1 + ((ip - anchor) >> 6);
+                    continue;
+                }
+
+                // Grow the match backwards into pending literals, then forwards
+                while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1]) {
+                    --ip;
+                    --ref;
+                }
+                std::size_t length = MIN_MATCH;
+                while (ip + length < matchLimit && src[ref + length] == src[ip + length]) {
+                    ++length;
+                }
+
+                op = writeSequence(dst, op, src + anchor, ip - anchor, ip - ref, length);
+                ip += length;
+                anchor = ip;
+
+                // Index a position inside the match so the next one can chain off it
+                if (ip - 2 <= lastMatchStart) {
+                    table[hashSequence(read32(src + ip - 2))] = ip - 2;
+                }
+            }
+        }
+
+        return writeSequence(dst, op, src + anchor, srcSize - anchor, 0, 0);
+    }
+
+    bool decompress(const unsigned char* src, std::size_t srcSize,
+                    unsigned char* dst, std::size_t dstSize) {
+        std::size_t ip = 0;
+        std::size_t op = 0;
+
+        while (ip < srcSize) {
+            unsigned token = src[ip++];
+
+            std::size_t literalLength = token >> 4;
+            if (literalLength == RUN_MASK && !readLength(src, srcSize, ip, literalLength)) {
+                return false;
+            }
+            if (literalLength > srcSize - ip || literalLength > dstSize - op) {
+                return false;
+            }
+            if (literalLength > 0) {
+                std::memcpy(dst + op, src + ip, literalLength);
+            }
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == srcSize) {
+                return op == dstSize;
+            }
+
+            if (srcSize - ip < 2) {
+                return false;
+            }
+            std::size_t offset = src[ip] | (static_cast<std::size_t>(src[ip + 1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > op) {
+                return false;
+            }
+
+            std::size_t matchLength = token & RUN_MASK;
+            if (matchLength == RUN_MASK && !readLength(src, srcSize, ip, matchLength)) {
+                return false;
+            }
+            matchLength += MIN_MATCH;
+            if (matchLength > dstSize - op) {
+                return false;
+            }
+
+            // A match shorter than its offset is one copy. Longer ones repeat
+            // the last offset bytes; every chunk written extends the source
+            // run, so copy in doubling non-overlapping chunks.
+            const unsigned char* match = dst + op - offset;
+            std::size_t copied = 0;
+            while (copied < matchLength) {
+                std::size_t chunk = std::min(offset + copied, matchLength - copied);
+                std::memcpy(dst + op + copied, match, chunk);
+                copied += chunk;
+            }
+            op += matchLength;
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+
+// LZ4 block format (no frame header), used for the pixel blobs in assets.pak.
+// Output is readable by the reference LZ4_decompress_safe and vice versa.
+namespace Lz4 {
+    // Worst-case compressed size for srcSize input bytes
+    std::size_t compressBound(std::size_t srcSize);
+
+    // Greedy single-pass compressor. dst must hold compressBound(srcSize)
+    // bytes; returns the compressed size, or 0 if dst is too small.
+    std::size_t compress(const unsigned char* src, std::size_t srcSize,
+                         unsigned char* dst, std::size_t dstCapacity);
+
+    // Bounds-checked decoder. Succeeds only if the block decodes to exactly
+    // dstSize bytes, so a corrupt blob never writes past dst.
+    bool decompress(const unsigned char* src, std::size_t srcSize,
+                    unsigned char* dst, std::size_t dstSize);
+}
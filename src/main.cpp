@@ -1,8 +1,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
-#include <iostream>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include "player.h"
 #include "enemies/enemy_factory.h"
 #include "config.h"
@@ -14,11 +15,65 @@
 #include "gold_manager.h"
 #include "shop.h"
 #include "weapon_selection.h"
+#include "asset_bundle.h"
+#include "log.h"
+#include "alloc_tracker.h"
+#include "text_format.h"
+#include "frame_arena.h"
+#include "projectile_system.h"
+#include "spatial_grid.h"
+#include "explosion_system.h"
+#include "beam_system.h"
+#include "lightning_system.h"
+#include "status_effect_system.h"
+#include "force_field_system.h"
+#include "separation.h"
+#include "flow_field.h"
+#include "world_wrap.h"
+#include "ai_lod.h"
+#include "view_culling.h"
+#include "health_bar_batch.h"
+#include "render_queue.h"
+#include "debug_draw.h"
+#include "particle_system.h"
+#include "combat_text.h"
+#include "quality_governor.h"
+#include "input.h"
+#include "frame_pacer.h"
+
+int main(int argc, char* argv[]) {
+    // Start the background log writer before anything can report
+    Log::start(Config::LOG_FILE_PATH);
+
+    // --zero-alloc-test: drive the menus with default choices, then fail if
+    // any steady-state PLAYING frame touches the heap
+    bool zeroAllocTest = false;
+    PacingMode pacingMode = PacingMode::CAPPED;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--zero-alloc-test") == 0) {
+            zeroAllocTest = true;
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            pacingMode = PacingMode::VSYNC;
+        } else if (std::strcmp(argv[i], "--uncapped") == 0) {
+            pacingMode = PacingMode::UNCAPPED;
+        }
+    }
+    if (zeroAllocTest && !AllocTracker::isEnabled()) {
+        LOG_ERROR("--zero-alloc-test needs a build with allocation tracking (no NDEBUG)");
+        Log::stop();
+        return 1;
+    }
+    int steadyFrames = 0;
+    int allocatingFrames = 0;
 
-int main() {
     // Create a window using config values
     sf::RenderWindow window(sf::VideoMode(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT), Config::WINDOW_TITLE);
-    window.setFramerateLimit(60);
+    FramePacer pacer(pacingMode, Config::TARGET_FPS);
+
+    // Map the pre-decoded asset bundle; loaders fall back to loose files without it
+    if (!AssetBundle::getInstance().open(Config::ASSET_BUNDLE_PATH)) {
+        LOG_INFO("Asset bundle not found, loading loose asset files");
+    }
 
     // Create views
     sf::View view(sf::FloatRect(0, 0, Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT));
@@ -27,7 +82,8 @@ int main() {
     // Create and initialize background menu
     BackgroundMenu backgroundMenu;
     if (!backgroundMenu.initialize()) {
-        std::cerr << "Failed to initialize background menu" << std::endl;
+        LOG_ERROR("Failed to initialize background menu");
+        Log::stop();
         return -1;
     }
     backgroundMenu.activate();
@@ -42,7 +98,7 @@ int main() {
     GameState currentState = BACKGROUND_SELECTION;
 
     // Clock for delta time and FPS calculation
-    sf::Clock clock;
+    sf::Clock frameWorkClock;  // Update + draw only; the frame limiter's wait is excluded
     sf::Clock fpsClock;
     int frameCount = 0;
     float fps = 0;
@@ -60,6 +116,8 @@ int main() {
     std::unique_ptr<GoldManager> goldManager;
     std::unique_ptr<Shop> shop;
     std::unique_ptr<WeaponSelection> weaponSelection;
+    std::vector<Enemy*> visibleEnemies; // Refilled from the grid each frame
+    visibleEnemies.reserve(1024);
     
     // Talent selection state
     int selectedTalentIndex = 0;
@@ -67,18 +125,47 @@ int main() {
     
     // Debug text setup
     sf::Font debugFont;
-    if (!debugFont.loadFromFile("assets/ARIAL.TTF")) {
-        std::cerr << "Failed to load font from assets/ARIAL.TTF" << std::endl;
+    if (!loadFontAsset(debugFont, "assets/ARIAL.TTF")) {
+        LOG_ERROR("Failed to load font from assets/ARIAL.TTF");
+        Log::stop();
         return -1;
     }
+    DebugDraw::getInstance().setFont(debugFont);
+    CombatText::getInstance().loadFont("assets/ARIAL.TTF");
     sf::Text debugText;
     debugText.setFont(debugFont);
     debugText.setCharacterSize(14);
     debugText.setFillColor(sf::Color::White);
 
+    // HUD text, kept across frames and reformatted in place
+    sf::String hudBuffer;
+    sf::Text goldText;
+    goldText.setFont(debugFont);
+    goldText.setCharacterSize(24);
+    goldText.setFillColor(sf::Color::Yellow);
+    goldText.setStyle(sf::Text::Bold);
+    goldText.setPosition(10, Config::WINDOW_HEIGHT - 40);
+    sf::Text shopText;
+    shopText.setFont(debugFont);
+    shopText.setCharacterSize(20);
+    shopText.setPosition(10, Config::WINDOW_HEIGHT - 70);
+
+    // Start pacing only now, so asset loading doesn't land in the first frame
+    pacer.configure(window);
+
     // Main game loop
     while (window.isOpen()) {
-        float deltaTime = clock.restart().asSeconds();
+        float deltaTime = pacer.beginFrame();
+        frameWorkClock.restart();
+        AllocTracker::beginFrame();
+
+        // Apply the quality level chosen from previous frames' timings
+        const QualitySettings& quality = QualityGovernor::getInstance().getSettings();
+        ParticleSystem::getInstance().setEmissionScale(quality.particleScale);
+        Minimap::getInstance().setRefreshInterval(quality.minimapRefreshInterval);
+        AiLodScheduler::getInstance().setIntervalScale(quality.aiIntervalScale);
+        DebugDraw::getInstance().setEnabled(quality.debugDraw);
+        GameState frameStartState = currentState;
         
         // Calculate FPS
         frameCount++;
@@ -88,9 +175,34 @@ int main() {
             fpsClock.restart();
         }
 
-        // Handle events
+        // Handle events; every event also feeds this frame's input snapshot
+        Input& input = Input::getInstance();
+        input.beginFrame();
         sf::Event event;
-        while (window.pollEvent(event)) {
+        bool testInputSent = false;
+        auto nextEvent = [&](sf::Event& e) {
+            if (window.pollEvent(e)) {
+                return true;
+            }
+            // The allocation test confirms the default menu choices and skips
+            // talent picks itself
+            if (!zeroAllocTest || testInputSent || currentState == PLAYING) {
+                return false;
+            }
+            testInputSent = true;
+            e.type = sf::Event::KeyPressed;
+            e.key = sf::Event::KeyEvent{};
+            if (currentState == BACKGROUND_SELECTION) {
+                e.key.code = sf::Keyboard::Enter;
+            } else if (currentState == WEAPON_SELECTION) {
+                e.key.code = sf::Keyboard::E;
+            } else {
+                e.key.code = sf::Keyboard::Escape;
+            }
+            return true;
+        };
+        while (nextEvent(event)) {
+            input.handleEvent(event);
             if (event.type == sf::Event::Closed) {
                 window.close();
             }
@@ -114,10 +226,23 @@ int main() {
                     shop = std::make_unique<Shop>();
                     weaponSelection = std::make_unique<WeaponSelection>();
                     
+                    // Shots from a previous run don't carry over
+                    ProjectileSystem::getInstance().clear();
+                    ExplosionSystem::getInstance().clear();
+                    BeamSystem::getInstance().clear();
+                    LightningSystem::getInstance().clear();
+                    StatusEffectSystem::getInstance().clear();
+                    ForceFieldSystem::getInstance().clear();
+                    AiLodScheduler::getInstance().reset();
+                    ParticleSystem::getInstance().clear();
+                    CombatText::getInstance().clear();
+                    Minimap::getInstance().reset();
+                    
                     // Create enemies
                     for (int i = 0; i < 15; i++) {
                         enemies.push_back(createRandomEnemy());
                     }
+                    getEnemyGrid().rebuild(enemies);
                     
                     // Set initial view center to player position
                     view.setCenter(main_player->getWorldPosition());
@@ -157,7 +282,8 @@ int main() {
             } else if (currentState == TALENT_SELECTION) {
                 // Handle talent selection events
                 if (event.type == sf::Event::KeyPressed) {
-                    auto availableTalents = main_player->getTalentTree().getAvailableTalents();
+                    std::pmr::vector<int> availableTalents(&FrameArena::getInstance());
+                    main_player->getTalentTree().getAvailableTalents(availableTalents);
                     
                     if (event.key.code == sf::Keyboard::Left && selectedTalentIndex > 0) {
                         selectedTalentIndex--;
@@ -193,23 +319,46 @@ int main() {
                 // Only update game if shop UI is not showing (pause game during shopping)
                 if (!shop->isUIShowing()) {
                     // Update game state normally
-                    main_player->move(deltaTime);
-                    main_player->update(deltaTime, enemies);
-                    main_player->wrapPosition();
+                    {
+                        AllocScope scope(AllocSubsystem::PLAYER);
+                        main_player->move(deltaTime, input.getSnapshot());
+                        main_player->update(deltaTime, enemies, input.getSnapshot());
+                        main_player->wrapPosition();
+                    }
                     
-                    // Update all enemies
-                    for (auto& enemy : enemies) {
-                        if (enemy->isAlive()) {
-                            enemy->updateAI(main_player->getWorldPosition(), deltaTime);
-                            enemy->move(deltaTime);
-                            enemy->updatePosition(main_player->getWorldPosition(), sf::Vector2f(0, 0));
-                        }
+                    // Advance every live projectile, whichever weapon fired it,
+                    // then apply this tick's blasts as one batch
+                    {
+                        AllocScope scope(AllocSubsystem::PROJECTILES);
+                        ProjectileSystem::getInstance().update(deltaTime, getEnemyGrid(), main_player.get());
+                        ExplosionSystem::getInstance().resolve(getEnemyGrid(), main_player.get());
+                        ExplosionSystem::getInstance().update(deltaTime);
+                        BeamSystem::getInstance().update(deltaTime);
+                        LightningSystem::getInstance().update(deltaTime);
+                    }
+                    
+                    // Update all enemies; burning and the like tick first, and
+                    // slowed enemies run on a scaled clock. Distant enemies
+                    // update less often (see AiLodScheduler).
+                    {
+                        AllocScope scope(AllocSubsystem::ENEMIES);
+                        StatusEffectSystem::getInstance().tick(deltaTime);
+                        getPlayerFlowField().update(main_player->getWorldPosition());
+                        AiLodScheduler::getInstance().update(enemies, main_player->getWorldPosition(), deltaTime);
+
+                        // Gravity wells and repulsors push on top of normal movement
+                        ForceFieldSystem::getInstance().update(deltaTime, getEnemyGrid());
+
+                        // Keep chasing enemies from collapsing into one blob
+                        applySeparation(getEnemyGrid(), deltaTime);
                     }
 
                     // Check for dead enemies and award experience
                     auto it = enemies.begin();
                     while (it != enemies.end()) {
                         if (!(*it)->isAlive()) {
+                            AllocScope dropScope(AllocSubsystem::SPAWNING);
+
                             // Check if this enemy should drop a health pack
                             if (Enemy::shouldDropHealthPack(*main_player)) {
                                 sf::Vector2f healthPackPos = (*it)->getWorldPosition();
@@ -219,8 +368,11 @@ int main() {
                             // Drop gold
                             goldManager->spawnGold((*it)->getWorldPosition(), (*it)->getGoldValue());
                             
+                            ParticleSystem::getInstance().emitDeath((*it)->getWorldPosition());
+
                             // Award experience to player before removing the enemy
                             main_player->gainExperience((*it)->getExperienceValue());
+                            StatusEffectSystem::getInstance().removeEnemy(it->get());
                             it = enemies.erase(it);
                         } else {
                             ++it;
@@ -228,53 +380,72 @@ int main() {
                     }
                     
                     // Update health packs
-                    auto healthPackIt = healthPacks.begin();
-                    while (healthPackIt != healthPacks.end()) {
-                        (*healthPackIt)->update(deltaTime);
+                    {
+                        AllocScope scope(AllocSubsystem::PICKUPS);
+                        auto healthPackIt = healthPacks.begin();
+                        while (healthPackIt != healthPacks.end()) {
+                            (*healthPackIt)->update(deltaTime);
                         
-                        // Check for collision with player
-                        if ((*healthPackIt)->checkCollision(*main_player)) {
-                            main_player->healPlayer((*healthPackIt)->getHealAmount());
-                            healthPackIt = healthPacks.erase(healthPackIt);
-                        } else if ((*healthPackIt)->isExpired()) {
-                            // Remove expired health packs
-                            healthPackIt = healthPacks.erase(healthPackIt);
-                        } else {
-                            ++healthPackIt;
+                            // Check for collision with player
+                            if ((*healthPackIt)->checkCollision(*main_player)) {
+                                main_player->healPlayer((*healthPackIt)->getHealAmount());
+                                ParticleSystem::getInstance().emitPickup((*healthPackIt)->getPosition(), sf::Color(80, 255, 120));
+                                healthPackIt = healthPacks.erase(healthPackIt);
+                            } else if ((*healthPackIt)->isExpired()) {
+                                // Remove expired health packs
+                                healthPackIt = healthPacks.erase(healthPackIt);
+                            } else {
+                                ++healthPackIt;
+                            }
                         }
-                    }
                     
-                    // Update gold manager
-                    goldManager->update(deltaTime, *main_player);
+                        // Update gold manager
+                        goldManager->update(deltaTime, *main_player);
+                    }
+
+                    ParticleSystem::getInstance().update(deltaTime);
+                    CombatText::getInstance().update(deltaTime);
                     
                     // Spawn new enemies if needed
                     if (enemies.size() < MIN_ENEMIES || enemySpawnClock.getElapsedTime().asSeconds() > ENEMY_SPAWN_INTERVAL) {
+                        AllocScope spawnScope(AllocSubsystem::SPAWNING);
                         enemies.push_back(createRandomEnemy());
                         enemySpawnClock.restart();
                     }
 
+                    // Re-index once the enemy list is final for this tick
+                    getEnemyGrid().rebuild(enemies);
+                    Minimap::getInstance().update(deltaTime, getEnemyGrid());
+
                     // Update view to follow player
                     view.setCenter(main_player->getWorldPosition());
                     window.setView(view);
 
                     // Check for collision between player and enemies
-                    for (auto& enemy : enemies) {
-                        if (enemy->isAlive() && main_player->getBounds().intersects(enemy->getBounds())) {
-                            enemy->attack(*main_player);
+                    {
+                        AllocScope scope(AllocSubsystem::ENEMIES);
+                        for (auto& enemy : enemies) {
+                            if (enemy->isAlive() && wrappedIntersects(main_player->getBounds(), enemy->getBounds())) {
+                                enemy->attack(*main_player);
+                            }
                         }
                     }
                 }
                 
                 // Always update shop (even when paused, so it can handle input)
-                shop->update(deltaTime, *main_player);
+                {
+                    AllocScope scope(AllocSubsystem::SHOP);
+                    shop->update(deltaTime, *main_player);
+                }
                 
                 // Give player experience for testing (remove this later)
-                if (sf::Keyboard::isKeyPressed(sf::Keyboard::X)) {
+                if (input.getSnapshot().isDown(sf::Keyboard::X)) {
                     main_player->gainExperience(10);
                 }
                 
                 // TEMPORARY: Spawn health pack for testing (remove this later)
-                if (sf::Keyboard::isKeyPressed(sf::Keyboard::H)) {
+                if (input.getSnapshot().wasPressed(sf::Keyboard::H)) {
+                    AllocScope spawnScope(AllocSubsystem::SPAWNING);
                     sf::Vector2f playerPos = main_player->getWorldPosition();
                     sf::Vector2f healthPackPos = playerPos + sf::Vector2f(50.f, 0.f); // Spawn to the right of player
                     healthPacks.push_back(std::make_unique<HealthPack>(healthPackPos));
@@ -296,82 +467,104 @@ int main() {
             // Set game view for drawing game objects
             window.setView(view);
 
+            // Only entities inside the view (plus a margin) are submitted;
+            // the grid is current here, so enemies come from a rect query
+            sf::FloatRect cullRect = getCullRect(view, Config::CULL_MARGIN);
+            const SpatialGrid& grid = getEnemyGrid();
+            visibleEnemies.clear();
+            grid.queryRect(cullRect, [&](std::size_t item) {
+                visibleEnemies.push_back(grid.getEnemy(item));
+            });
+
             // Draw background first (behind everything else)
             if (gameBackground) {
                 gameBackground->draw(window, main_player->getWorldPosition());
             }
 
-            // Draw game objects
-            main_player->draw(window);
-            for (const auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    enemy->draw(window);
+            // World objects go through the render queue so they overlap by
+            // depth; health bars, weapon effects and particles draw on top
+            RenderQueue& renderQueue = RenderQueue::getInstance();
+            renderQueue.begin();
+            {
+                AllocScope scope(AllocSubsystem::PLAYER);
+                main_player->submit(renderQueue);
+            }
+            HealthBarBatch& healthBars = HealthBarBatch::getInstance();
+            healthBars.begin();
+            {
+                AllocScope scope(AllocSubsystem::ENEMIES);
+                for (Enemy* enemy : visibleEnemies) {
+                    if (enemy->isAlive()) {
+                        enemy->submit(renderQueue);
+                        if (quality.healthBars) {
+                            enemy->addHealthBar(healthBars);
+                        }
+                    }
                 }
             }
-            
-            // Draw health packs
-            for (const auto& healthPack : healthPacks) {
-                healthPack->draw(window);
+            {
+                AllocScope scope(AllocSubsystem::PICKUPS);
+                for (const auto& healthPack : healthPacks) {
+                    if (cullRect.contains(healthPack->getPosition())) {
+                        healthPack->submit(renderQueue);
+                    }
+                }
+                goldManager->submit(renderQueue, cullRect);
             }
-            
-            // Draw gold drops
-            goldManager->draw(window);
-            
-            // Draw shop
-            shop->draw(window);
+            {
+                AllocScope scope(AllocSubsystem::SHOP);
+                shop->submit(renderQueue);
+            }
+            renderQueue.flush(window);
+            healthBars.draw(window);
+
+            {
+                AllocScope scope(AllocSubsystem::PLAYER);
+                main_player->drawOverlay(window);
+            }
+            {
+                AllocScope scope(AllocSubsystem::PROJECTILES);
+                ProjectileSystem::getInstance().draw(window);
+                ForceFieldSystem::getInstance().draw(window);
+                ExplosionSystem::getInstance().draw(window);
+                BeamSystem::getInstance().draw(window);
+                LightningSystem::getInstance().draw(window);
+            }
+            ParticleSystem::getInstance().draw(window);
+            CombatText::getInstance().draw(window);
 
             // Draw debug information in game view
             if (Config::DEBUG_MODE) {
-                if (Config::SHOW_COLLISION_BOXES) {
-                    // Draw collision boxes
-                    sf::FloatRect playerBounds = main_player->getBounds();
-                    sf::RectangleShape playerBox(sf::Vector2f(playerBounds.width, playerBounds.height));
-                    playerBox.setPosition(playerBounds.left, playerBounds.top);
-                    playerBox.setFillColor(sf::Color::Transparent);
-                    playerBox.setOutlineColor(sf::Color::Green);
-                    playerBox.setOutlineThickness(1);
-                    window.draw(playerBox);
-
-                    for (const auto& enemy : enemies) {
+                DebugDraw& debugDraw = DebugDraw::getInstance();
+                if (Config::SHOW_COLLISION_BOXES && debugDraw.isEnabled()) {
+                    // Collision boxes for everything on screen
+                    debugDraw.box(main_player->getBounds(), sf::Color::Green);
+                    for (Enemy* enemy : visibleEnemies) {
                         if (enemy->isAlive()) {
-                            sf::FloatRect enemyBounds = enemy->getBounds();
-                            sf::RectangleShape enemyBox(sf::Vector2f(enemyBounds.width, enemyBounds.height));
-                            enemyBox.setPosition(enemyBounds.left, enemyBounds.top);
-                            enemyBox.setFillColor(sf::Color::Transparent);
-                            enemyBox.setOutlineColor(sf::Color::Red);
-                            enemyBox.setOutlineThickness(1);
-                            window.draw(enemyBox);
+                            debugDraw.box(enemy->getBounds(), sf::Color::Red);
                         }
                     }
-                    
-                    // Draw health pack collision boxes
                     for (const auto& healthPack : healthPacks) {
                         sf::Vector2f packPos = healthPack->getPosition();
-                        sf::RectangleShape packBox(sf::Vector2f(20.f, 20.f));
-                        packBox.setPosition(packPos.x - 10.f, packPos.y - 10.f);
-                        packBox.setFillColor(sf::Color::Transparent);
-                        packBox.setOutlineColor(sf::Color::Cyan);
-                        packBox.setOutlineThickness(1);
-                        window.draw(packBox);
+                        if (!cullRect.contains(packPos)) continue;
+                        debugDraw.box(sf::FloatRect(packPos.x - 10.f, packPos.y - 10.f, 20.f, 20.f), sf::Color::Cyan);
                     }
                 }
+                // Also carries the weapon range circles queued by the player
+                debugDraw.flush(window);
             }
 
-            // Switch to UI view for minimap and FPS
+            // Switch to UI view for minimap and FPS; the minimap still
+            // shows every enemy, so it takes the full list
+            AllocScope hudScope(AllocSubsystem::HUD);
             window.setView(uiView);
-            Minimap::draw(window, *main_player, enemies, shop.get());
+            Minimap::getInstance().draw(window, *main_player, shop.get());
             
             // Draw shop UI on top of everything
             shop->drawUI(window);
             
             // Draw gold counter
-            sf::Text goldText;
-            goldText.setFont(debugFont);
-            goldText.setString("Gold: " + std::to_string(main_player->getGold()));
-            goldText.setCharacterSize(24);
-            goldText.setFillColor(sf::Color::Yellow);
-            goldText.setStyle(sf::Text::Bold);
-            goldText.setPosition(10, Config::WINDOW_HEIGHT - 40);
+            setTextFormatted(goldText, hudBuffer, "Gold: %d", main_player->getGold());
             window.draw(goldText);
             
             // Draw shop distance indicator
@@ -380,21 +573,17 @@ int main() {
                 sf::Vector2f shopPos = shop->getPosition();
                 float distance = std::sqrt(std::pow(playerPos.x - shopPos.x, 2) + std::pow(playerPos.y - shopPos.y, 2));
                 
-                sf::Text shopText;
-                shopText.setFont(debugFont);
                 if (distance <= 100.0f) {
                     if (shop->isUIShowing()) {
-                        shopText.setString("SHOP - A/D: Category, W/S: Select, E: Buy, Q: Close");
+                        setTextFormatted(shopText, hudBuffer, "SHOP - A/D: Category, W/S: Select, E: Buy, Q: Close");
                     } else {
-                        shopText.setString("SHOP - Press E to open");
+                        setTextFormatted(shopText, hudBuffer, "SHOP - Press E to open");
                     }
                     shopText.setFillColor(sf::Color::Green);
                 } else {
-                    shopText.setString("Shop: " + std::to_string(static_cast<int>(distance)) + "m away");
+                    setTextFormatted(shopText, hudBuffer, "Shop: %dm away", static_cast<int>(distance));
                     shopText.setFillColor(sf::Color::Cyan);
                 }
-                shopText.setCharacterSize(20);
-                shopText.setPosition(10, Config::WINDOW_HEIGHT - 70);
                 window.draw(shopText);
                 
             }
@@ -406,13 +595,57 @@ int main() {
                     if (enemy->isAlive()) aliveCount++;
                 }
                 
-                std::string debugInfo = "FPS: " + std::to_string(static_cast<int>(fps)) + "\n";
-                debugInfo += "Alive Enemies: " + std::to_string(aliveCount) + "\n";
-                debugInfo += "Health Packs: " + std::to_string(healthPacks.size()) + "\n";
-                debugInfo += "Press 'B' to change background\n";
-                debugInfo += "Press 'X' to gain experience (debug)";
-                
-                debugText.setString(debugInfo);
+                // Allocation counts are from the previous completed frame
+                AllocStats frameAllocs = AllocTracker::getFrameStats();
+                // Per-subsystem split of the same frame; quiet subsystems are left out
+                char allocBreakdown[192] = "none";
+                int breakdownLength = 0;
+                for (int i = 0; i < static_cast<int>(AllocSubsystem::COUNT); ++i) {
+                    AllocSubsystem subsystem = static_cast<AllocSubsystem>(i);
+                    AllocStats stats = AllocTracker::getFrameStats(subsystem);
+                    if (stats.count == 0) continue;
+                    int written = std::snprintf(allocBreakdown + breakdownLength, sizeof(allocBreakdown) - breakdownLength,
+                                                "%s%s %llu", breakdownLength > 0 ? ", " : "",
+                                                AllocTracker::getSubsystemName(subsystem),
+                                                static_cast<unsigned long long>(stats.count));
+                    if (written < 0 || breakdownLength + written >= static_cast<int>(sizeof(allocBreakdown))) break;
+                    breakdownLength += written;
+                }
+                // Direct-hit credit for the shots of the equipped weapon
+                ProjectileSystem::OwnerStats weaponShots;
+                if (Weapon* weapon = main_player->getCurrentWeapon()) {
+                    weaponShots = ProjectileSystem::getInstance().getOwnerStats(weapon->getId());
+                }
+                setTextFormatted(debugText, hudBuffer,
+                    "FPS: %d\nAlive Enemies: %d (%d drawn)\nHealth Packs: %d\n"
+                    "Projectiles: %d (weapon: %d dmg, %d kills)\nParticles: %d\n"
+                    "Render queue: %d items, %d draws\n"
+                    "Allocs/frame: %llu (%llu B)%s\n"
+                    "  by subsystem: %s\n"
+                    "Frame arena: %zu B (peak %zu B)\n"
+                    "AI near/mid/far: %d/%d/%d (%.2f ms)\n"
+                    "Quality: %s (%.1f ms/frame)\n"
+                    "Pacing: %s %.2f ms, jitter %.2f, worst %.1f\n"
+                    "Press 'B' to change background\nPress 'X' to gain experience (debug)",
+                    static_cast<int>(fps), aliveCount, static_cast<int>(visibleEnemies.size()),
+                    static_cast<int>(healthPacks.size()),
+                    static_cast<int>(ProjectileSystem::getInstance().getCount()),
+                    weaponShots.damage, weaponShots.kills,
+                    static_cast<int>(ParticleSystem::getInstance().getCount()),
+                    static_cast<int>(RenderQueue::getInstance().getSubmittedCount()),
+                    RenderQueue::getInstance().getDrawCallCount(),
+                    static_cast<unsigned long long>(frameAllocs.count),
+                    static_cast<unsigned long long>(frameAllocs.bytes),
+                    AllocTracker::isEnabled() ? "" : " [tracking off]",
+                    allocBreakdown,
+                    FrameArena::getInstance().getLastFrameBytes(),
+                    FrameArena::getInstance().getHighWaterMark(),
+                    AiLodScheduler::getInstance().getNearCount(), AiLodScheduler::getInstance().getMidCount(),
+                    AiLodScheduler::getInstance().getFarCount(),
+                    static_cast<double>(AiLodScheduler::getInstance().getAverageMs()),
+                    quality.name, static_cast<double>(QualityGovernor::getInstance().getAverageMs()),
+                    pacer.getModeName(), static_cast<double>(pacer.getStats().meanMs),
+                    static_cast<double>(pacer.getStats().jitterMs), static_cast<double>(pacer.getStats().worstMs));
                 debugText.setPosition(10, 10);
                 window.draw(debugText);
             }
@@ -447,7 +680,8 @@ int main() {
             window.draw(instructText);
             
             // Highlight selected talent
-            auto availableTalents = main_player->getTalentTree().getAvailableTalents();
+            std::pmr::vector<int> availableTalents(&FrameArena::getInstance());
+            main_player->getTalentTree().getAvailableTalents(availableTalents);
             if (!availableTalents.empty() && selectedTalentIndex < static_cast<int>(availableTalents.size())) {
                 const auto& nodes = main_player->getTalentTree().getNodes();
                 if (availableTalents[selectedTalentIndex] < static_cast<int>(nodes.size())) {
@@ -462,8 +696,57 @@ int main() {
             }
         }
 
+        QualityGovernor::getInstance().reportFrame(frameWorkClock.getElapsedTime().asSeconds() * 1000.0f);
         window.display();
+        pacer.waitForNextFrame();
+
+        // Per-tick scratch memory is dead once the frame is presented
+        FrameArena::getInstance().reset();
+
+        // Steady state: a whole PLAYING frame with no spawns or drops, the
+        // game not paused for the shop, and past the warm-up period
+        if (zeroAllocTest && frameStartState == PLAYING && currentState == PLAYING && !shop->isUIShowing()) {
+            steadyFrames++;
+            AllocStats spawning = AllocTracker::getCurrentStats(AllocSubsystem::SPAWNING);
+            if (steadyFrames > Config::ZERO_ALLOC_TEST_WARMUP_FRAMES && spawning.count == 0) {
+                bool allocated = false;
+                for (int i = 0; i < static_cast<int>(AllocSubsystem::COUNT); ++i) {
+                    AllocSubsystem subsystem = static_cast<AllocSubsystem>(i);
+                    AllocStats stats = AllocTracker::getCurrentStats(subsystem);
+                    if (stats.count > 0) {
+                        LOG_ERROR("Frame %d: %s made %llu allocations (%llu bytes)", steadyFrames,
+                                  AllocTracker::getSubsystemName(subsystem),
+                                  static_cast<unsigned long long>(stats.count),
+                                  static_cast<unsigned long long>(stats.bytes));
+                        allocated = true;
+                    }
+                }
+                if (allocated) {
+                    allocatingFrames++;
+                }
+            }
+            if (steadyFrames >= Config::ZERO_ALLOC_TEST_WARMUP_FRAMES + Config::ZERO_ALLOC_TEST_FRAMES) {
+                window.close();
+            }
+        }
+    }
+
+    if (zeroAllocTest) {
+        if (steadyFrames < Config::ZERO_ALLOC_TEST_WARMUP_FRAMES + Config::ZERO_ALLOC_TEST_FRAMES) {
+            LOG_ERROR("Zero-allocation test stopped after %d of %d frames", steadyFrames,
+                      Config::ZERO_ALLOC_TEST_WARMUP_FRAMES + Config::ZERO_ALLOC_TEST_FRAMES);
+            Log::stop();
+            return 1;
+        }
+        if (allocatingFrames > 0) {
+            LOG_ERROR("Zero-allocation test failed: %d of %d steady-state frames allocated",
+                      allocatingFrames, Config::ZERO_ALLOC_TEST_FRAMES);
+            Log::stop();
+            return 1;
+        }
+        LOG_INFO("Zero-allocation test passed");
     }
 
+    Log::stop();
     return 0;
 }
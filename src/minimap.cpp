@@ -1,66 +1,128 @@
 #include "minimap.h"
 #include "config.h"
 #include "shop.h"
+#include "spatial_grid.h"
+#include <algorithm>
+#include <cmath>
 
-void Minimap::draw(sf::RenderWindow& window, const Player& player, const std::vector<std::unique_ptr<Enemy>>& enemies, const Shop* shop) {
-    // Create minimap background
-    sf::RectangleShape minimapBackground(sf::Vector2f(Config::MINIMAP_SIZE, Config::MINIMAP_SIZE));
-    minimapBackground.setPosition(Config::WINDOW_WIDTH - Config::MINIMAP_SIZE - Config::MINIMAP_PADDING, 
-                                Config::MINIMAP_PADDING);
-    minimapBackground.setFillColor(sf::Color(0, 0, 0, 128));
-    minimapBackground.setOutlineThickness(1);
-    minimapBackground.setOutlineColor(sf::Color::White);
-    
-    // Draw minimap background
-    window.draw(minimapBackground);
-    
-    // Calculate player position on minimap
-    sf::CircleShape playerDot(Config::MINIMAP_PLAYER_SIZE);
-    playerDot.setFillColor(sf::Color::Green);
-    playerDot.setOrigin(Config::MINIMAP_PLAYER_SIZE, Config::MINIMAP_PLAYER_SIZE); // Center the origin
-    sf::Vector2f playerPos = player.getWorldPosition();
-    playerDot.setPosition(
-        Config::WINDOW_WIDTH - Config::MINIMAP_SIZE - Config::MINIMAP_PADDING + 
-        (playerPos.x * Config::MINIMAP_SCALE),
-        Config::MINIMAP_PADDING + 
-        (playerPos.y * Config::MINIMAP_SCALE)
-    );
-    
-    // Draw player dot on minimap
-    window.draw(playerDot);
-    
-    // Draw all alive enemy dots on minimap
-    for (const auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            sf::CircleShape enemyDot(Config::MINIMAP_ENEMY_SIZE);
-            enemyDot.setFillColor(sf::Color::Red);
-            enemyDot.setOrigin(Config::MINIMAP_ENEMY_SIZE, Config::MINIMAP_ENEMY_SIZE); // Center the origin
-            sf::Vector2f enemyPos = enemy->getWorldPosition();
-            enemyDot.setPosition(
-                Config::WINDOW_WIDTH - Config::MINIMAP_SIZE - Config::MINIMAP_PADDING + 
-                (enemyPos.x * Config::MINIMAP_SCALE),
-                Config::MINIMAP_PADDING + 
-                (enemyPos.y * Config::MINIMAP_SCALE)
-            );
-            window.draw(enemyDot);
+namespace {
+    constexpr int HEATMAP_SATURATION = 8;  // Enemies per texel drawn at full intensity
+}
+
+Minimap& Minimap::getInstance() {
+    static Minimap instance;
+    return instance;
+}
+
+Minimap::Minimap()
+    : refreshTimer_(0.0f),
+      refreshInterval_(Config::MINIMAP_REFRESH_INTERVAL),
+      heatmapActive_(false),
+      origin_(Config::WINDOW_WIDTH - Config::MINIMAP_SIZE - Config::MINIMAP_PADDING, Config::MINIMAP_PADDING),
+      enemyDots_(sf::Quads),
+      heatmapWidth_(static_cast<unsigned>(std::ceil(Config::WORLD_WIDTH * Config::MINIMAP_SCALE))),
+      heatmapHeight_(static_cast<unsigned>(std::ceil(Config::WORLD_HEIGHT * Config::MINIMAP_SCALE))) {
+    background_.setSize(sf::Vector2f(Config::MINIMAP_SIZE, Config::MINIMAP_SIZE));
+    background_.setPosition(origin_);
+    background_.setFillColor(sf::Color(0, 0, 0, 128));
+    background_.setOutlineThickness(1);
+    background_.setOutlineColor(sf::Color::White);
+
+    playerDot_.setRadius(Config::MINIMAP_PLAYER_SIZE);
+    playerDot_.setFillColor(sf::Color::Green);
+    playerDot_.setOrigin(Config::MINIMAP_PLAYER_SIZE, Config::MINIMAP_PLAYER_SIZE);
+
+    shopDot_.setRadius(6.0f); // Slightly larger than other dots
+    shopDot_.setFillColor(sf::Color::Yellow);
+    shopDot_.setOutlineColor(sf::Color(255, 215, 0)); // Gold outline
+    shopDot_.setOutlineThickness(2.0f);
+    shopDot_.setOrigin(6.0f, 6.0f);
+
+    heatmapCounts_.assign(heatmapWidth_ * heatmapHeight_, 0);
+    heatmapPixels_.assign(heatmapWidth_ * heatmapHeight_ * 4, 0);
+    heatmapTexture_.create(heatmapWidth_, heatmapHeight_);
+    heatmapSprite_.setTexture(heatmapTexture_, true);
+    heatmapSprite_.setPosition(origin_);
+}
+
+sf::Vector2f Minimap::toMinimap(const sf::Vector2f& worldPos) const {
+    return origin_ + worldPos * Config::MINIMAP_SCALE;
+}
+
+void Minimap::update(float deltaTime, const SpatialGrid& grid) {
+    refreshTimer_ -= deltaTime;
+    if (refreshTimer_ > 0.0f) return;
+    refreshTimer_ = refreshInterval_;
+
+    heatmapActive_ = grid.getItemCount() > static_cast<std::size_t>(Config::MINIMAP_HEATMAP_THRESHOLD);
+    if (heatmapActive_) {
+        rebuildHeatmap(grid);
+    } else {
+        rebuildDots(grid);
+    }
+}
+
+void Minimap::rebuildDots(const SpatialGrid& grid) {
+    const float size = Config::MINIMAP_ENEMY_SIZE;
+    std::size_t count = grid.getItemCount();
+    enemyDots_.resize(count * 4);
+    for (std::size_t item = 0; item < count; ++item) {
+        sf::Vector2f center = toMinimap(grid.getPosition(item));
+        sf::Vertex* quad = &enemyDots_[item * 4];
+        quad[0].position = sf::Vector2f(center.x - size, center.y - size);
+        quad[1].position = sf::Vector2f(center.x + size, center.y - size);
+        quad[2].position = sf::Vector2f(center.x + size, center.y + size);
+        quad[3].position = sf::Vector2f(center.x - size, center.y + size);
+        quad[0].color = quad[1].color = quad[2].color = quad[3].color = sf::Color::Red;
+    }
+}
+
+void Minimap::rebuildHeatmap(const SpatialGrid& grid) {
+    // Bin enemies into texels, one texel per minimap pixel
+    std::fill(heatmapCounts_.begin(), heatmapCounts_.end(), 0);
+    const int maxX = static_cast<int>(heatmapWidth_) - 1;
+    const int maxY = static_cast<int>(heatmapHeight_) - 1;
+    std::size_t count = grid.getItemCount();
+    for (std::size_t item = 0; item < count; ++item) {
+        sf::Vector2f pos = grid.getPosition(item) * Config::MINIMAP_SCALE;
+        int x = std::min(std::max(static_cast<int>(pos.x), 0), maxX);
+        int y = std::min(std::max(static_cast<int>(pos.y), 0), maxY);
+        ++heatmapCounts_[y * heatmapWidth_ + x];
+    }
+
+    // Empty texels stay transparent; density ramps from dark red to yellow
+    for (std::size_t i = 0; i < heatmapCounts_.size(); ++i) {
+        int binCount = heatmapCounts_[i];
+        sf::Uint8* pixel = &heatmapPixels_[i * 4];
+        if (binCount == 0) {
+            pixel[3] = 0;
+            continue;
         }
+        float intensity = std::min(binCount, HEATMAP_SATURATION) / static_cast<float>(HEATMAP_SATURATION);
+        pixel[0] = static_cast<sf::Uint8>(160 + 95 * std::min(1.0f, intensity * 2.0f));
+        pixel[1] = static_cast<sf::Uint8>(255 * std::max(0.0f, intensity * 2.0f - 1.0f));
+        pixel[2] = 0;
+        pixel[3] = static_cast<sf::Uint8>(140 + 115 * intensity);
     }
-    
+    heatmapTexture_.update(heatmapPixels_.data());
+}
+
+void Minimap::draw(sf::RenderWindow& window, const Player& player, const Shop* shop) {
+    window.draw(background_);
+
+    playerDot_.setPosition(toMinimap(player.getWorldPosition()));
+    window.draw(playerDot_);
+
+    // Enemy layer as of the last refresh
+    if (heatmapActive_) {
+        window.draw(heatmapSprite_);
+    } else if (enemyDots_.getVertexCount() > 0) {
+        window.draw(enemyDots_);
+    }
+
     // Draw shop on minimap if it exists
     if (shop && shop->isVisible()) {
-        sf::CircleShape shopDot(6.0f); // Slightly larger than other dots
-        shopDot.setFillColor(sf::Color::Yellow);
-        shopDot.setOutlineColor(sf::Color(255, 215, 0)); // Gold outline
-        shopDot.setOutlineThickness(2.0f);
-        shopDot.setOrigin(6.0f, 6.0f);
-        
-        sf::Vector2f shopPos = shop->getPosition();
-        shopDot.setPosition(
-            Config::WINDOW_WIDTH - Config::MINIMAP_SIZE - Config::MINIMAP_PADDING + 
-            (shopPos.x * Config::MINIMAP_SCALE),
-            Config::MINIMAP_PADDING + 
-            (shopPos.y * Config::MINIMAP_SCALE)
-        );
-        window.draw(shopDot);
+        shopDot_.setPosition(toMinimap(shop->getPosition()));
+        window.draw(shopDot_);
     }
-} 
\ No newline at end of file
+}
@@ -1,13 +1,55 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <vector>
-#include <memory>
 #include "player.h"
-#include "enemy.h"
 
 class Shop;
+class SpatialGrid;
 
+// Minimap in the top-right corner. The enemy layer is rebuilt from the
+// enemy grid every refresh interval (Config::MINIMAP_REFRESH_INTERVAL by
+// default) rather than every frame, and drawn with a single call: one quad per enemy below
+// Config::MINIMAP_HEATMAP_THRESHOLD enemies, otherwise a density texture
+// with one texel per minimap pixel. Above the threshold the draw cost is
+// fixed no matter how many enemies there are.
 class Minimap {
 public:
-    static void draw(sf::RenderWindow& window, const Player& player, const std::vector<std::unique_ptr<Enemy>>& enemies, const Shop* shop = nullptr);
-}; 
\ No newline at end of file
+    static Minimap& getInstance();
+
+    // Count down to the next refresh of the enemy layer
+    void update(float deltaTime, const SpatialGrid& grid);
+
+    // Rebuild the enemy layer on the next update (new game, etc.)
+    void reset() { refreshTimer_ = 0.0f; enemyDots_.clear(); heatmapActive_ = false; }
+
+    void draw(sf::RenderWindow& window, const Player& player, const Shop* shop = nullptr);
+
+    bool isHeatmapActive() const { return heatmapActive_; }
+    void setRefreshInterval(float seconds) { refreshInterval_ = seconds; }
+
+private:
+    Minimap();
+
+    void rebuildDots(const SpatialGrid& grid);
+    void rebuildHeatmap(const SpatialGrid& grid);
+    sf::Vector2f toMinimap(const sf::Vector2f& worldPos) const;
+
+    float refreshTimer_;
+    float refreshInterval_;
+    bool heatmapActive_;
+    sf::Vector2f origin_;  // Top-left corner on screen
+
+    sf::RectangleShape background_;
+    sf::CircleShape playerDot_;
+    sf::CircleShape shopDot_;
+
+    sf::VertexArray enemyDots_;
+
+    // Heatmap: enemy count per texel, turned into RGBA pixels
+    unsigned heatmapWidth_;
+    unsigned heatmapHeight_;
+    std::vector<int> heatmapCounts_;
+    std::vector<sf::Uint8> heatmapPixels_;
+    sf::Texture heatmapTexture_;
+    sf::Sprite heatmapSprite_;
+};
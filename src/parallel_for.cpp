@@ -0,0 +1,112 @@
+#include "parallel_for.h"
+#include <algorithm>
+
+namespace {
+    constexpr unsigned MAX_WORKERS = 7;
+    constexpr std::size_t CHUNKS_PER_THREAD = 4;  // Some slack for uneven chunks
+}
+
+ParallelFor& ParallelFor::getInstance() {
+    static ParallelFor instance;
+    return instance;
+}
+
+ParallelFor::ParallelFor() :
+    generation_(0),
+    activeWorkers_(0),
+    stopping_(false),
+    fn_(nullptr),
+    context_(nullptr),
+    count_(0),
+    chunkSize_(0),
+    chunkCount_(0),
+    nextChunk_(0),
+    remainingChunks_(0) {
+    // The calling thread works too, so one fewer worker than cores
+    unsigned cores = std::thread::hardware_concurrency();
+    unsigned workerCount = cores > 1 ? std::min(cores - 1, MAX_WORKERS) : 0;
+    workers_.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&ParallelFor::workerLoop, this);
+    }
+}
+
+ParallelFor::~ParallelFor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ParallelFor::runChunks(std::size_t count, std::size_t minChunk, ChunkFn fn, void* context) {
+    if (count == 0) return;
+
+    minChunk = std::max<std::size_t>(minChunk, 1);
+    if (workers_.empty() || count <= minChunk) {
+        fn(context, 0, count);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // A worker that woke late for the previous job may still be leaving
+        done_.wait(lock, [this] { return activeWorkers_ == 0; });
+
+        std::size_t threads = workers_.size() + 1;
+        fn_ = fn;
+        context_ = context;
+        count_ = count;
+        chunkSize_ = std::max(minChunk, (count + threads * CHUNKS_PER_THREAD - 1) / (threads * CHUNKS_PER_THREAD));
+        chunkCount_ = (count + chunkSize_ - 1) / chunkSize_;
+        nextChunk_.store(0);
+        remainingChunks_.store(chunkCount_);
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    drain();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return remainingChunks_.load() == 0 && activeWorkers_ == 0; });
+}
+
+void ParallelFor::drain() {
+    while (true) {
+        std::size_t chunk = nextChunk_.fetch_add(1);
+        if (chunk >= chunkCount_) break;
+
+        std::size_t begin = chunk * chunkSize_;
+        std::size_t end = std::min(count_, begin + chunkSize_);
+        fn_(context_, begin, end);
+
+        if (remainingChunks_.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.notify_all();
+        }
+    }
+}
+
+void ParallelFor::workerLoop() {
+    unsigned long long seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) return;
+            seen = generation_;
+            ++activeWorkers_;
+        }
+
+        drain();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --activeWorkers_;
+        }
+        done_.notify_all();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fork-join helper on a persistent worker pool. run() splits [0, count)
+// into chunks, the workers and the calling thread take chunks until none
+// are left, and run() returns once every chunk has finished. Nothing is
+// allocated per call, so it is safe inside the zero-allocation frame.
+//
+// The callable must only write state owned by its own index range.
+class ParallelFor {
+public:
+    static ParallelFor& getInstance();
+
+    // fn(begin, end) for each chunk; chunks hold at least minChunk items
+    template <typename Fn>
+    void run(std::size_t count, std::size_t minChunk, Fn&& fn) {
+        using Callable = std::remove_reference_t<Fn>;
+        runChunks(count, minChunk,
+                  [](void* context, std::size_t begin, std::size_t end) {
+                      (*static_cast<Callable*>(context))(begin, end);
+                  },
+                  const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+    std::size_t getWorkerCount() const { return workers_.size(); }
+
+private:
+    using ChunkFn = void (*)(void*, std::size_t, std::size_t);
+
+    ParallelFor();
+    ~ParallelFor();
+    ParallelFor(const ParallelFor&) = delete;
+    ParallelFor& operator=(const ParallelFor&) = delete;
+
+    void runChunks(std::size_t count, std::size_t minChunk, ChunkFn fn, void* context);
+    void workerLoop();
+    void drain();
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    unsigned long long generation_;
+    int activeWorkers_;   // Workers inside drain(), guarded by mutex_
+    bool stopping_;
+
+    // Current job; written under mutex_ before generation_ is bumped
+    ChunkFn fn_;
+    void* context_;
+    std::size_t count_;
+    std::size_t chunkSize_;
+    std::size_t chunkCount_;
+    std::atomic<std::size_t> nextChunk_;
+    std::atomic<std::size_t> remainingChunks_;
+};
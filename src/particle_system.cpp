@@ -0,0 +1,189 @@
+#include "particle_system.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::size_t POOL_CAPACITY = 32768;  // Per blend mode
+    constexpr float PI = 3.14159265f;
+}
+
+ParticleSystem& ParticleSystem::getInstance() {
+    static ParticleSystem instance;
+    return instance;
+}
+
+ParticleSystem::ParticleSystem() : randomState_(0x9E3779B9u), emissionScale_(1.0f) {
+    for (Pool& pool : pools_) {
+        pool.positionX.resize(POOL_CAPACITY);
+        pool.positionY.resize(POOL_CAPACITY);
+        pool.velocityX.resize(POOL_CAPACITY);
+        pool.velocityY.resize(POOL_CAPACITY);
+        pool.age.resize(POOL_CAPACITY);
+        pool.inverseLifetime.resize(POOL_CAPACITY);
+        pool.size.resize(POOL_CAPACITY);
+        pool.drag.resize(POOL_CAPACITY);
+        pool.color.resize(POOL_CAPACITY);
+        pool.vertices.setPrimitiveType(sf::Quads);
+        pool.vertices.resize(POOL_CAPACITY * 4);
+    }
+}
+
+float ParticleSystem::random01() {
+    // xorshift32; rand() is too slow to call per particle
+    randomState_ ^= randomState_ << 13;
+    randomState_ ^= randomState_ >> 17;
+    randomState_ ^= randomState_ << 5;
+    return (randomState_ >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::emit(const sf::Vector2f& position, const ParticleBurst& burst) {
+    Pool& pool = pools_[static_cast<int>(burst.blend)];
+    std::size_t room = POOL_CAPACITY - pool.count;
+    int scaled = static_cast<int>(burst.count * emissionScale_ + 0.5f);
+    std::size_t count = std::min(static_cast<std::size_t>(std::max(scaled, 0)), room);
+    float inverseLifetime = 1.0f / std::max(burst.lifetime, 0.001f);
+
+    for (std::size_t n = 0; n < count; ++n) {
+        std::size_t i = pool.count++;
+        float angle = random01() * 2.0f * PI;
+        float speed = burst.minSpeed + (burst.maxSpeed - burst.minSpeed) * random01();
+        pool.positionX[i] = position.x;
+        pool.positionY[i] = position.y;
+        pool.velocityX[i] = std::cos(angle) * speed;
+        pool.velocityY[i] = std::sin(angle) * speed;
+        pool.age[i] = 0.0f;
+        // Vary lifetimes a little so a burst doesn't vanish all at once
+        pool.inverseLifetime[i] = inverseLifetime * (0.8f + 0.4f * random01());
+        pool.size[i] = burst.size;
+        pool.drag[i] = burst.drag;
+        pool.color[i] = burst.color;
+    }
+}
+
+void ParticleSystem::emitHit(const sf::Vector2f& position) {
+    ParticleBurst burst;
+    burst.count = 4;
+    burst.lifetime = 0.2f;
+    burst.size = 2.0f;
+    burst.color = sf::Color(255, 230, 150);
+    emit(position, burst);
+}
+
+void ParticleSystem::emitDeath(const sf::Vector2f& position) {
+    ParticleBurst sparks;
+    sparks.count = 16;
+    sparks.maxSpeed = 260.0f;
+    sparks.lifetime = 0.5f;
+    sparks.color = sf::Color(255, 120, 40);
+    emit(position, sparks);
+
+    ParticleBurst debris;
+    debris.count = 10;
+    debris.minSpeed = 20.0f;
+    debris.maxSpeed = 90.0f;
+    debris.lifetime = 0.8f;
+    debris.size = 4.0f;
+    debris.drag = 2.0f;
+    debris.color = sf::Color(90, 30, 30);
+    debris.blend = ParticleBlend::ALPHA;
+    emit(position, debris);
+}
+
+void ParticleSystem::emitPickup(const sf::Vector2f& position, const sf::Color& color) {
+    ParticleBurst burst;
+    burst.count = 10;
+    burst.minSpeed = 60.0f;
+    burst.maxSpeed = 120.0f;
+    burst.lifetime = 0.35f;
+    burst.size = 2.5f;
+    burst.color = color;
+    emit(position, burst);
+}
+
+void ParticleSystem::update(float deltaTime) {
+    for (Pool& pool : pools_) {
+        simulate(pool, deltaTime);
+        removeExpired(pool);
+    }
+}
+
+void ParticleSystem::simulate(Pool& pool, float deltaTime) {
+    // No branches and no aliasing between the arrays, so this vectorises
+    const std::size_t count = pool.count;
+    float* positionX = pool.positionX.data();
+    float* positionY = pool.positionY.data();
+    float* velocityX = pool.velocityX.data();
+    float* velocityY = pool.velocityY.data();
+    float* age = pool.age.data();
+    const float* drag = pool.drag.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        float damping = std::max(0.0f, 1.0f - drag[i] * deltaTime);
+        velocityX[i] *= damping;
+        velocityY[i] *= damping;
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        age[i] += deltaTime;
+    }
+}
+
+void ParticleSystem::removeExpired(Pool& pool) {
+    // Swap-remove: order doesn't matter within a blend mode
+    std::size_t i = 0;
+    while (i < pool.count) {
+        if (pool.age[i] * pool.inverseLifetime[i] < 1.0f) {
+            ++i;
+            continue;
+        }
+        std::size_t last = --pool.count;
+        pool.positionX[i] = pool.positionX[last];
+        pool.positionY[i] = pool.positionY[last];
+        pool.velocityX[i] = pool.velocityX[last];
+        pool.velocityY[i] = pool.velocityY[last];
+        pool.age[i] = pool.age[last];
+        pool.inverseLifetime[i] = pool.inverseLifetime[last];
+        pool.size[i] = pool.size[last];
+        pool.drag[i] = pool.drag[last];
+        pool.color[i] = pool.color[last];
+    }
+}
+
+void ParticleSystem::draw(sf::RenderWindow& window) const {
+    for (int blend = 0; blend < static_cast<int>(ParticleBlend::COUNT); ++blend) {
+        const Pool& pool = pools_[blend];
+        if (pool.count == 0) continue;
+
+        for (std::size_t i = 0; i < pool.count; ++i) {
+            float remaining = 1.0f - pool.age[i] * pool.inverseLifetime[i];
+            float half = pool.size[i] * remaining;
+            float x = pool.positionX[i];
+            float y = pool.positionY[i];
+            sf::Color color = pool.color[i];
+            color.a = static_cast<sf::Uint8>(color.a * remaining);
+
+            sf::Vertex* quad = &pool.vertices[i * 4];
+            quad[0].position = sf::Vector2f(x - half, y - half);
+            quad[1].position = sf::Vector2f(x + half, y - half);
+            quad[2].position = sf::Vector2f(x + half, y + half);
+            quad[3].position = sf::Vector2f(x - half, y + half);
+            quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+        }
+
+        // Only the live prefix of the preallocated array is submitted
+        sf::RenderStates states(blend == static_cast<int>(ParticleBlend::ADDITIVE) ? sf::BlendAdd : sf::BlendAlpha);
+        window.draw(&pool.vertices[0], pool.count * 4, sf::Quads, states);
+    }
+}
+
+void ParticleSystem::clear() {
+    for (Pool& pool : pools_) {
+        pool.count = 0;
+    }
+}
+
+std::size_t ParticleSystem::getCount() const {
+    std::size_t total = 0;
+    for (const Pool& pool : pools_) {
+        total += pool.count;
+    }
+    return total;
+}
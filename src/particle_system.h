@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+enum class ParticleBlend {
+    ALPHA,     // Smoke, debris, anything that should darken
+    ADDITIVE,  // Sparks and glows
+    COUNT
+};
+
+// One emission: count particles thrown out in random directions
+struct ParticleBurst {
+    int count = 8;
+    float minSpeed = 40.0f;
+    float maxSpeed = 160.0f;
+    float lifetime = 0.4f;
+    float size = 3.0f;          // Half-extent of the quad at birth; shrinks to zero
+    float drag = 3.0f;          // Fraction of velocity lost per second
+    sf::Color color = sf::Color::White;
+    ParticleBlend blend = ParticleBlend::ADDITIVE;
+};
+
+// Short-lived visual particles. Each blend mode has a fixed-capacity pool
+// stored as structure-of-arrays; emitting into a full pool drops the
+// excess instead of allocating. The simulation is one straight-line pass
+// over flat float arrays, and each pool is drawn as one vertex array.
+class ParticleSystem {
+public:
+    static ParticleSystem& getInstance();
+
+    void emit(const sf::Vector2f& position, const ParticleBurst& burst);
+
+    // Fraction of every burst actually emitted (quality governor)
+    void setEmissionScale(float scale) { emissionScale_ = scale; }
+
+    // Presets for the game's emitters
+    void emitHit(const sf::Vector2f& position);
+    void emitDeath(const sf::Vector2f& position);
+    void emitPickup(const sf::Vector2f& position, const sf::Color& color);
+
+    void update(float deltaTime);
+
+    // Fades and shrinks particles over their lifetime; one draw per pool
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getCount() const;
+
+private:
+    ParticleSystem();
+
+    struct Pool {
+        std::size_t count = 0;
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> age;
+        std::vector<float> inverseLifetime;  // Age * this is progress in [0, 1]
+        std::vector<float> size;
+        std::vector<float> drag;
+        std::vector<sf::Color> color;
+        mutable sf::VertexArray vertices;
+    };
+
+    void simulate(Pool& pool, float deltaTime);
+    void removeExpired(Pool& pool);
+    float random01();
+
+    Pool pools_[static_cast<int>(ParticleBlend::COUNT)];
+    std::uint32_t randomState_;
+    float emissionScale_;
+};
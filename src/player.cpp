@@ -1,8 +1,12 @@
 #include <string>
 #include <SFML/Graphics.hpp>
 #include "player.h"
+#include "asset_bundle.h"
 #include "config.h"
+#include "text_format.h"
 #include "enemy.h"
+#include "input.h"
+#include "render_queue.h"
 #include "weapons/weapon_factory.h"
 #include "talents/talent_factory.h"
 
@@ -35,12 +39,18 @@ Player::Player() :
     shape.setPosition(worldPosition);
     
     // Initialize font and text
-    if (!font.loadFromFile("ARIAL.TTF")) {
+    if (!loadFontAsset(font, "assets/ARIAL.TTF")) {
         // Handle font loading error
     }
     healthText.setFont(font);
     healthText.setCharacterSize(20);
     healthText.setFillColor(sf::Color::White);
+    weaponText_.setFont(font);
+    weaponText_.setCharacterSize(16);
+    weaponText_.setFillColor(sf::Color::Cyan);
+    levelText_.setFont(font);
+    levelText_.setCharacterSize(14);
+    levelText_.setFillColor(sf::Color(255, 215, 0)); // Gold color using RGB values
 
     // Initialize with default weapons using the factory
     weapons_.push_back(createSword());
@@ -52,17 +62,17 @@ Player::Player() :
     talentTree_.generatePermanentTree();
 }
 
-void Player::move(float deltaTime) {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left) || sf::Keyboard::isKeyPressed(sf::Keyboard::A)) {
+void Player::move(float deltaTime, const InputSnapshot& input) {
+    if (input.isDown(sf::Keyboard::Left) || input.isDown(sf::Keyboard::A)) {
         worldPosition.x -= speed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right) || sf::Keyboard::isKeyPressed(sf::Keyboard::D)) {
+    if (input.isDown(sf::Keyboard::Right) || input.isDown(sf::Keyboard::D)) {
         worldPosition.x += speed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || sf::Keyboard::isKeyPressed(sf::Keyboard::W)) {
+    if (input.isDown(sf::Keyboard::Up) || input.isDown(sf::Keyboard::W)) {
         worldPosition.y -= speed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || sf::Keyboard::isKeyPressed(sf::Keyboard::S)) {
+    if (input.isDown(sf::Keyboard::Down) || input.isDown(sf::Keyboard::S)) {
         worldPosition.y += speed * deltaTime;
     }
     
@@ -70,7 +80,7 @@ void Player::move(float deltaTime) {
     shape.setPosition(worldPosition);
 }
 
-void Player::update(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies) {
+void Player::update(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies, const InputSnapshot& input) {
     // Handle regeneration
     if (regenRate_ > 0.0f && health < maxHealth_) {
         static float regenTimer = 0.0f;
@@ -85,30 +95,24 @@ void Player::update(float deltaTime, const std::vector<std::unique_ptr<Enemy>>&
     // Update current weapon
     if (getCurrentWeapon()) {
         getCurrentWeapon()->update(deltaTime);
-        
-        // Handle ranged weapon projectile updates with enemy collision
-        if (getCurrentWeapon()->getType() == Weapon::Type::RANGED) {
-            RangedWeapon* rangedWeapon = static_cast<RangedWeapon*>(getCurrentWeapon());
-            rangedWeapon->updateProjectiles(deltaTime, enemies, this);
-        }
     }
 
-    // Handle weapon switching
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num1) && weapons_.size() > 0) {
+    // Handle weapon switching, once per key press
+    if (input.wasPressed(sf::Keyboard::Num1) && weapons_.size() > 0) {
         switchWeapon(0);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num2) && weapons_.size() > 1) {
+    if (input.wasPressed(sf::Keyboard::Num2) && weapons_.size() > 1) {
         switchWeapon(1);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num3) && weapons_.size() > 2) {
+    if (input.wasPressed(sf::Keyboard::Num3) && weapons_.size() > 2) {
         switchWeapon(2);
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num4) && weapons_.size() > 3) {
+    if (input.wasPressed(sf::Keyboard::Num4) && weapons_.size() > 3) {
         switchWeapon(3);
     }
 
-    // Handle manual attack
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) {
+    // Handle manual attack (held)
+    if (input.isDown(sf::Keyboard::Space)) {
         attack(enemies);
     }
 
@@ -188,8 +192,7 @@ void Player::gainExperience(int exp) {
 void Player::processLevelUp() {
     if (pendingLevelUps_ > 0) {
         // For the first level up, unlock the top row if no talents are unlocked yet
-        auto availableTalents = talentTree_.getAvailableTalents();
-        if (availableTalents.empty()) {
+        if (!talentTree_.hasAvailableTalents()) {
             talentTree_.unlockTopRow();
         }
         // For subsequent level ups, the selectTalent method handles unlocking
@@ -225,17 +228,19 @@ int Player::getExperienceNeeded() const {
     return level * 100; // Simple scaling: level 1 = 100 exp, level 2 = 200 exp, etc.
 }
 
-void Player::draw(sf::RenderWindow& window) {
-    // Draw the player shape
-    window.draw(shape);
-    
+void Player::submit(RenderQueue& queue) const {
+    sf::FloatRect bounds = shape.getGlobalBounds();
+    queue.submit(shape, bounds.top + bounds.height, RenderLayer::ACTORS);
+}
+
+void Player::drawOverlay(sf::RenderWindow& window) {
     // Draw current weapon effects
     if (getCurrentWeapon()) {
         getCurrentWeapon()->draw(window, worldPosition);
     }
     
     // Update and draw health text
-    healthText.setString("HP: " + std::to_string(health) + "/" + std::to_string(maxHealth_));
+    setTextFormatted(healthText, textBuffer_, "HP: %d/%d", health, maxHealth_);
     // Position text above player
     sf::FloatRect textBounds = healthText.getLocalBounds();
     healthText.setPosition(
@@ -246,44 +251,29 @@ void Player::draw(sf::RenderWindow& window) {
 
     // Draw weapon info
     if (getCurrentWeapon()) {
-        sf::Text weaponText;
-        weaponText.setFont(font);
-        weaponText.setCharacterSize(16);
-        weaponText.setFillColor(sf::Color::Cyan);
-        
-        std::string weaponInfo = "Weapon: " + getCurrentWeapon()->getName();
-        weaponInfo += " (" + std::to_string(currentWeaponIndex_ + 1) + "/" + std::to_string(weapons_.size()) + ")";
-        weaponText.setString(weaponInfo);
+        setTextFormatted(weaponText_, textBuffer_, "Weapon: %s (%d/%d)", getCurrentWeapon()->getName().c_str(),
+                         currentWeaponIndex_ + 1, static_cast<int>(weapons_.size()));
         
         // Position weapon text below health
-        sf::FloatRect weaponBounds = weaponText.getLocalBounds();
-        weaponText.setPosition(
+        sf::FloatRect weaponBounds = weaponText_.getLocalBounds();
+        weaponText_.setPosition(
             shape.getPosition().x - weaponBounds.width / 2,
             shape.getPosition().y - shape.getSize().y / 2 - 50
         );
-        window.draw(weaponText);
+        window.draw(weaponText_);
     }
     
     // Draw level and experience info
-    sf::Text levelText;
-    levelText.setFont(font);
-    levelText.setCharacterSize(14);
-    levelText.setFillColor(sf::Color(255, 215, 0)); // Gold color using RGB values
-    
-    std::string levelInfo = "Level " + std::to_string(level) + " (";
-    levelInfo += std::to_string(experience) + "/" + std::to_string(getExperienceNeeded()) + " XP)";
-    if (pendingLevelUps_ > 0) {
-        levelInfo += " - LEVEL UP!";
-    }
-    levelText.setString(levelInfo);
+    setTextFormatted(levelText_, textBuffer_, "Level %d (%d/%d XP)%s", level, experience, getExperienceNeeded(),
+                     pendingLevelUps_ > 0 ? " - LEVEL UP!" : "");
     
     // Position level text below weapon info
-    sf::FloatRect levelBounds = levelText.getLocalBounds();
-    levelText.setPosition(
+    sf::FloatRect levelBounds = levelText_.getLocalBounds();
+    levelText_.setPosition(
         shape.getPosition().x - levelBounds.width / 2,
         shape.getPosition().y - shape.getSize().y / 2 - 70
     );
-    window.draw(levelText);
+    window.draw(levelText_);
 }
 
 void Player::wrapPosition() {
@@ -294,20 +284,26 @@ void Player::wrapPosition() {
     if (worldPosition.y > Config::WORLD_HEIGHT) worldPosition.y = 1;
 }
 
-int Player::calculateModifiedDamage(int baseDamage) const {
-    float modifiedDamage = static_cast<float>(baseDamage) * damageMultiplier_;
+int Player::calculateModifiedDamage(int baseDamage, bool* critical) const {
+    float modifiedDamage = calculateSustainedDamage(static_cast<float>(baseDamage));
+    if (critical) *critical = false;
     
     // Apply critical strike chance
     if (critChance_ > 0.0f) {
         float critRoll = static_cast<float>(rand()) / RAND_MAX;
         if (critRoll < critChance_) {
             modifiedDamage *= critMultiplier_;
+            if (critical) *critical = true;
         }
     }
     
     return static_cast<int>(modifiedDamage);
 }
 
+float Player::calculateSustainedDamage(float baseDamage) const {
+    return baseDamage * damageMultiplier_;
+}
+
 float Player::calculateModifiedCooldown(float baseCooldown) const {
     // Attack speed multiplier reduces cooldown
     return baseCooldown / (1.0f + attackSpeedMultiplier_);
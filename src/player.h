@@ -9,16 +9,20 @@
 
 // Forward declarations
 class Enemy;
+class InputSnapshot;
+class RenderQueue;
 
 class Player {
 public:
     Player();
-    void move(float deltaTime);
+    void move(float deltaTime, const InputSnapshot& input);
     void takeDamage(int damage);
     void gainExperience(int exp);
     void addGold(int amount);
     bool isAlive() const;
-    void draw(sf::RenderWindow& window);
+    void submit(RenderQueue& queue) const;
+    // Weapon effects and the text above the player, drawn after the world
+    void drawOverlay(sf::RenderWindow& window);
     sf::FloatRect getBounds() const { return shape.getGlobalBounds(); }
     sf::Vector2f getPosition() const { return shape.getPosition(); }
     sf::Vector2f getWorldPosition() const { return worldPosition; }
@@ -26,7 +30,7 @@ public:
     void updatePosition(const sf::Vector2f& cameraOffset);
 
     // Weapon system
-    void update(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies);
+    void update(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies, const InputSnapshot& input);
     void attack(const std::vector<std::unique_ptr<Enemy>>& enemies);
     void switchWeapon(int weaponIndex);
     void addWeapon(std::unique_ptr<Weapon> weapon);
@@ -78,7 +82,8 @@ public:
     void addDodgeChance(float bonus) { dodgeChance_ += bonus; }
     
     // Helper methods for calculating talent-modified values
-    int calculateModifiedDamage(int baseDamage) const;
+    int calculateModifiedDamage(int baseDamage, bool* critical = nullptr) const;  // critical: set when the crit roll hits
+    float calculateSustainedDamage(float baseDamage) const;  // Talent multipliers without the crit roll, for damage over time
     float calculateModifiedCooldown(float baseCooldown) const;
     void applyLifeSteal(int damageDealt);
 
@@ -91,6 +96,9 @@ private:
     float speed;
     sf::RectangleShape shape;
     sf::Text healthText;
+    sf::Text weaponText_;
+    sf::Text levelText_;
+    sf::String textBuffer_;  // Reused when reformatting the HUD lines
     sf::Font font;
     sf::Vector2f worldPosition;  // World position (independent of camera)
 
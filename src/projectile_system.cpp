@@ -0,0 +1,265 @@
+#include "projectile_system.h"
+#include "enemy.h"
+#include "player.h"
+#include "spatial_grid.h"
+#include "explosion_system.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::size_t INITIAL_CAPACITY = 8192;
+    constexpr float HIT_RADIUS = 20.0f;
+    constexpr float HALF_SIZE = 3.0f; // Drawn as a 6x6 quad
+    constexpr float SEEK_RADIUS = 300.0f;        // How far homing shots look for a target
+    constexpr float RETARGET_INTERVAL = 0.15f;
+}
+
+ProjectileSystem& ProjectileSystem::getInstance() {
+    static ProjectileSystem instance;
+    return instance;
+}
+
+ProjectileSystem::ProjectileSystem() : vertices_(sf::Quads) {
+    positionX_.reserve(INITIAL_CAPACITY);
+    positionY_.reserve(INITIAL_CAPACITY);
+    velocityX_.reserve(INITIAL_CAPACITY);
+    velocityY_.reserve(INITIAL_CAPACITY);
+    lifetime_.reserve(INITIAL_CAPACITY);
+    damage_.reserve(INITIAL_CAPACITY);
+    owner_.reserve(INITIAL_CAPACITY);
+    color_.reserve(INITIAL_CAPACITY);
+    blastRadius_.reserve(INITIAL_CAPACITY);
+    blastFalloff_.reserve(INITIAL_CAPACITY);
+    homingRate_.reserve(INITIAL_CAPACITY);
+    speed_.reserve(INITIAL_CAPACITY);
+    targetX_.reserve(INITIAL_CAPACITY);
+    targetY_.reserve(INITIAL_CAPACITY);
+    hasTarget_.reserve(INITIAL_CAPACITY);
+    retargetTimer_.reserve(INITIAL_CAPACITY);
+}
+
+void ProjectileSystem::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const ProjectileSpec& spec) {
+    positionX_.push_back(position.x);
+    positionY_.push_back(position.y);
+    velocityX_.push_back(velocity.x);
+    velocityY_.push_back(velocity.y);
+    lifetime_.push_back(spec.lifetime);
+    damage_.push_back(spec.damage);
+    owner_.push_back(spec.ownerId);
+    color_.push_back(spec.color);
+    blastRadius_.push_back(spec.blastRadius);
+    blastFalloff_.push_back(spec.blastFalloff);
+    homingRate_.push_back(spec.homingRate);
+    speed_.push_back(std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y));
+    targetX_.push_back(position.x);
+    targetY_.push_back(position.y);
+    hasTarget_.push_back(0.0f);
+    retargetTimer_.push_back(0.0f);  // Pick a target on the first tick
+}
+
+void ProjectileSystem::update(float deltaTime, const SpatialGrid& grid, Player* player) {
+    retarget(deltaTime, grid);
+    steer(deltaTime);
+
+    // Integrate everything first; this loop is branch-free over flat arrays
+    std::size_t count = positionX_.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        positionX_[i] += velocityX_[i] * deltaTime;
+        positionY_[i] += velocityY_[i] * deltaTime;
+        lifetime_[i] -= deltaTime;
+    }
+
+    std::size_t i = 0;
+    while (i < positionX_.size()) {
+        // Sweep the hit circle over this tick's path so fast shots and long
+        // frames can't tunnel through an enemy; first contact wins. A path
+        // over the world's edge is also swept across it.
+        sf::Vector2f end(positionX_[i], positionY_[i]);
+        sf::Vector2f start(end.x - velocityX_[i] * deltaTime, end.y - velocityY_[i] * deltaTime);
+        sf::FloatRect sweep(std::min(start.x, end.x) - HIT_RADIUS, std::min(start.y, end.y) - HIT_RADIUS,
+                            std::fabs(end.x - start.x) + 2.0f * HIT_RADIUS, std::fabs(end.y - start.y) + 2.0f * HIT_RADIUS);
+        Enemy* target = nullptr;
+        float firstContact = 2.0f;
+        forEachWorldImage(sweep, [&](const sf::Vector2f& shift) {
+            grid.querySegment(start + shift, end + shift, HIT_RADIUS, [&](std::size_t item, float t) {
+                Enemy* enemy = grid.getEnemy(item);
+                if (t < firstContact && enemy->isAlive()) {
+                    firstContact = t;
+                    target = enemy;
+                }
+            });
+        });
+
+        if (!target) {
+            // Shots that leave the world come back in on the other side
+            sf::Vector2f wrapped = wrapWorldPosition(end);
+            positionX_[i] = wrapped.x;
+            positionY_[i] = wrapped.y;
+            if (lifetime_[i] <= 0.0f) {
+                // Shells that run out of range still go off
+                if (blastRadius_[i] > 0.0f) {
+                    detonate(i);
+                }
+                remove(i);
+            } else {
+                ++i;
+            }
+            continue;
+        }
+
+        // Back up to the point of impact so blasts centre where the shot hit
+        sf::Vector2f impact = wrapWorldPosition(start + (end - start) * firstContact);
+        positionX_[i] = impact.x;
+        positionY_[i] = impact.y;
+
+        if (blastRadius_[i] > 0.0f) {
+            detonate(i);
+        } else {
+            // Calculate modified damage using player's talents
+            bool critical = false;
+            int modifiedDamage = player ? player->calculateModifiedDamage(damage_[i], &critical) : damage_[i];
+            target->takeDamage(modifiedDamage, critical);
+            credit(owner_[i], modifiedDamage, !target->isAlive());
+
+            // Apply life steal if player has it
+            if (player) {
+                player->applyLifeSteal(modifiedDamage);
+            }
+        }
+        remove(i);
+    }
+}
+
+void ProjectileSystem::detonate(std::size_t index) {
+    // Full damage at the centre; the target hit directly is inside the blast
+    ExplosionSystem::getInstance().emit(sf::Vector2f(positionX_[index], positionY_[index]),
+                                        blastRadius_[index], damage_[index], blastFalloff_[index]);
+}
+
+void ProjectileSystem::retarget(float deltaTime, const SpatialGrid& grid) {
+    auto alive = [&grid](std::size_t item) { return grid.getEnemy(item)->isAlive(); };
+
+    std::size_t count = positionX_.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (homingRate_[i] <= 0.0f) continue;
+        retargetTimer_[i] -= deltaTime;
+        if (retargetTimer_[i] > 0.0f) continue;
+        retargetTimer_[i] = RETARGET_INTERVAL;
+
+        long item = grid.findNearestWrapped(sf::Vector2f(positionX_[i], positionY_[i]), SEEK_RADIUS, alive);
+        if (item >= 0) {
+            sf::Vector2f target = grid.getPosition(static_cast<std::size_t>(item));
+            targetX_[i] = target.x;
+            targetY_[i] = target.y;
+            hasTarget_[i] = 1.0f;
+        } else {
+            hasTarget_[i] = 0.0f;
+        }
+    }
+}
+
+void ProjectileSystem::steer(float deltaTime) {
+    // Blend velocity toward the target direction at full speed. Straight
+    // shots have a zero homing rate, so the blend is zero and the loop needs
+    // no homing test. The target may be across the world's edge.
+    std::size_t count = positionX_.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        float dx = wrappedAxisDelta(positionX_[i], targetX_[i], Config::WORLD_WIDTH);
+        float dy = wrappedAxisDelta(positionY_[i], targetY_[i], Config::WORLD_HEIGHT);
+        float inverseLength = speed_[i] / (std::sqrt(dx * dx + dy * dy) + 0.001f);
+        float blend = std::min(1.0f, homingRate_[i] * deltaTime) * hasTarget_[i];
+        velocityX_[i] += (dx * inverseLength - velocityX_[i]) * blend;
+        velocityY_[i] += (dy * inverseLength - velocityY_[i]) * blend;
+    }
+}
+
+void ProjectileSystem::draw(sf::RenderWindow& window) const {
+    std::size_t count = positionX_.size();
+    if (count == 0) return;
+
+    vertices_.resize(count * 4);
+    for (std::size_t i = 0; i < count; ++i) {
+        float x = positionX_[i];
+        float y = positionY_[i];
+        sf::Vertex* quad = &vertices_[i * 4];
+        quad[0].position = sf::Vector2f(x - HALF_SIZE, y - HALF_SIZE);
+        quad[1].position = sf::Vector2f(x + HALF_SIZE, y - HALF_SIZE);
+        quad[2].position = sf::Vector2f(x + HALF_SIZE, y + HALF_SIZE);
+        quad[3].position = sf::Vector2f(x - HALF_SIZE, y + HALF_SIZE);
+        quad[0].color = quad[1].color = quad[2].color = quad[3].color = color_[i];
+    }
+
+    window.draw(vertices_);
+}
+
+void ProjectileSystem::clear() {
+    positionX_.clear();
+    positionY_.clear();
+    velocityX_.clear();
+    velocityY_.clear();
+    lifetime_.clear();
+    damage_.clear();
+    owner_.clear();
+    color_.clear();
+    blastRadius_.clear();
+    blastFalloff_.clear();
+    homingRate_.clear();
+    speed_.clear();
+    targetX_.clear();
+    targetY_.clear();
+    hasTarget_.clear();
+    retargetTimer_.clear();
+    ownerStats_.clear();
+}
+
+ProjectileSystem::OwnerStats ProjectileSystem::getOwnerStats(std::uint32_t ownerId) const {
+    return ownerId < ownerStats_.size() ? ownerStats_[ownerId] : OwnerStats();
+}
+
+void ProjectileSystem::credit(std::uint32_t ownerId, int damage, bool killed) {
+    // Ids are handed out in order from 1, so the table stays small
+    if (ownerId >= ownerStats_.size()) {
+        ownerStats_.resize(ownerId + 1);
+    }
+    ownerStats_[ownerId].damage += damage;
+    if (killed) ++ownerStats_[ownerId].kills;
+}
+
+void ProjectileSystem::remove(std::size_t index) {
+    // Order doesn't matter, so fill the hole with the last projectile
+    std::size_t last = positionX_.size() - 1;
+    positionX_[index] = positionX_[last];
+    positionY_[index] = positionY_[last];
+    velocityX_[index] = velocityX_[last];
+    velocityY_[index] = velocityY_[last];
+    lifetime_[index] = lifetime_[last];
+    damage_[index] = damage_[last];
+    owner_[index] = owner_[last];
+    color_[index] = color_[last];
+    blastRadius_[index] = blastRadius_[last];
+    blastFalloff_[index] = blastFalloff_[last];
+    homingRate_[index] = homingRate_[last];
+    speed_[index] = speed_[last];
+    targetX_[index] = targetX_[last];
+    targetY_[index] = targetY_[last];
+    hasTarget_[index] = hasTarget_[last];
+    retargetTimer_[index] = retargetTimer_[last];
+
+    positionX_.pop_back();
+    positionY_.pop_back();
+    velocityX_.pop_back();
+    velocityY_.pop_back();
+    lifetime_.pop_back();
+    damage_.pop_back();
+    owner_.pop_back();
+    color_.pop_back();
+    blastRadius_.pop_back();
+    blastFalloff_.pop_back();
+    homingRate_.pop_back();
+    speed_.pop_back();
+    targetX_.pop_back();
+    targetY_.pop_back();
+    hasTarget_.pop_back();
+    retargetTimer_.pop_back();
+}
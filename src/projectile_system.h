@@ -0,0 +1,86 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+class Player;
+class SpatialGrid;
+
+// Everything about a shot except where it is and where it's going
+struct ProjectileSpec {
+    int damage = 0;
+    float lifetime = 3.0f;
+    std::uint32_t ownerId = 0;  // Weapon::getId() of the weapon that fired
+    sf::Color color = sf::Color::Yellow;
+    float blastRadius = 0.0f;   // > 0: explodes on impact or at end of life
+    float blastFalloff = 0.0f;  // Fraction of blast damage lost at the edge
+    float homingRate = 0.0f;    // > 0: steers toward the nearest enemy; higher turns faster
+};
+
+// World-level store for every live projectile. Weapons only spawn into it;
+// the system moves, collides and draws all projectiles in one pass each,
+// so shots keep flying after the player switches weapons.
+//
+// Storage is structure-of-arrays: the update loop streams through the
+// position/velocity/lifetime arrays and dead entries are removed by
+// swapping in the last element. Shots wrap at the world's edge like
+// everything else that moves.
+//
+// Homing projectiles keep a target point rather than an enemy pointer.
+// They look up the nearest enemy in the grid every few ticks, and steering
+// toward the point is a single flat pass over all projectiles.
+class ProjectileSystem {
+public:
+    static ProjectileSystem& getInstance();
+
+    void spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const ProjectileSpec& spec);
+
+    // Advance, collide against the enemy grid and drop expired projectiles.
+    // Explosive shots hand their blast to ExplosionSystem. Direct damage is
+    // scaled by the player's talents when a player is given.
+    void update(float deltaTime, const SpatialGrid& grid, Player* player = nullptr);
+
+    // Single draw call for all projectiles
+    void draw(sf::RenderWindow& window) const;
+
+    void clear();
+    std::size_t getCount() const { return positionX_.size(); }
+
+    // Direct hits credited to the weapon that fired them. Blast damage is
+    // resolved by ExplosionSystem and isn't credited.
+    struct OwnerStats {
+        int damage = 0;
+        int kills = 0;
+    };
+    OwnerStats getOwnerStats(std::uint32_t ownerId) const;
+
+private:
+    ProjectileSystem();
+
+    void remove(std::size_t index);
+    void credit(std::uint32_t ownerId, int damage, bool killed);
+    void detonate(std::size_t index);
+    void retarget(float deltaTime, const SpatialGrid& grid);
+    void steer(float deltaTime);
+
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    std::vector<float> lifetime_;
+    std::vector<int> damage_;
+    std::vector<std::uint32_t> owner_;
+    std::vector<sf::Color> color_;
+    std::vector<float> blastRadius_;
+    std::vector<float> blastFalloff_;
+    std::vector<float> homingRate_;
+    std::vector<float> speed_;          // Homing keeps the launch speed
+    std::vector<float> targetX_;
+    std::vector<float> targetY_;
+    std::vector<float> hasTarget_;      // 1 or 0, used as a multiplier
+    std::vector<float> retargetTimer_;
+
+    std::vector<OwnerStats> ownerStats_;  // Indexed by owner id
+
+    mutable sf::VertexArray vertices_;
+};
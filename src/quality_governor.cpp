@@ -0,0 +1,63 @@
+#include "quality_governor.h"
+#include "config.h"
+
+namespace {
+    const QualitySettings LEVELS[] = {
+        //  name        particles  bars   debug  minimap  AI
+        { "High",       1.0f,      true,  true,  0.10f,   1 },
+        { "Medium",     0.5f,      true,  true,  0.20f,   1 },
+        { "Low",        0.25f,     true,  false, 0.35f,   2 },
+        { "Minimum",    0.0f,      false, false, 0.50f,   4 },
+    };
+    constexpr int LEVEL_COUNT = sizeof(LEVELS) / sizeof(LEVELS[0]);
+
+    constexpr float SMOOTHING = 0.05f;        // Weight of the newest frame in the average
+    constexpr float UPGRADE_HEADROOM = 0.6f;  // Step up only below this fraction of the budget
+    constexpr int DOWNGRADE_FRAMES = 45;        // Longer than the smoothing lag, so one step is felt before the next
+    constexpr int UPGRADE_FRAMES = 240;
+}
+
+QualityGovernor& QualityGovernor::getInstance() {
+    static QualityGovernor instance;
+    return instance;
+}
+
+QualityGovernor::QualityGovernor() {
+    reset();
+}
+
+void QualityGovernor::reset() {
+    level_ = 0;
+    averageMs_ = 0.0f;
+    slowFrames_ = 0;
+    fastFrames_ = 0;
+}
+
+void QualityGovernor::reportFrame(float workMs) {
+    averageMs_ += (workMs - averageMs_) * SMOOTHING;
+    if (!Config::QUALITY_GOVERNOR_ENABLED) return;
+
+    if (averageMs_ > Config::FRAME_BUDGET_MS) {
+        ++slowFrames_;
+        fastFrames_ = 0;
+    } else if (averageMs_ < Config::FRAME_BUDGET_MS * UPGRADE_HEADROOM) {
+        ++fastFrames_;
+        slowFrames_ = 0;
+    } else {
+        // Inside the dead band: hold the current level
+        slowFrames_ = 0;
+        fastFrames_ = 0;
+    }
+
+    if (slowFrames_ >= DOWNGRADE_FRAMES && level_ < LEVEL_COUNT - 1) {
+        ++level_;
+        slowFrames_ = 0;
+    } else if (fastFrames_ >= UPGRADE_FRAMES && level_ > 0) {
+        --level_;
+        fastFrames_ = 0;
+    }
+}
+
+const QualitySettings& QualityGovernor::getSettings() const {
+    return LEVELS[level_];
+}
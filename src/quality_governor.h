@@ -0,0 +1,38 @@
+#pragma once
+
+// What the game is allowed to spend on optional work at one quality level
+struct QualitySettings {
+    const char* name;
+    float particleScale;           // Fraction of each particle burst that is emitted
+    bool healthBars;
+    bool debugDraw;                // Collision boxes, range circles and other debug layers
+    float minimapRefreshInterval;  // Seconds between minimap enemy layer rebuilds
+    int aiIntervalScale;           // Multiplies the mid/far AI update intervals
+};
+
+// Watches how long each frame's work takes and steps quality down when the
+// smoothed time stays over Config::FRAME_BUDGET_MS, or back up when it
+// stays well under. Stepping down needs a short run of slow frames and
+// stepping up a much longer run of fast ones, with a wide dead band
+// between the two thresholds, so the level settles instead of flipping.
+class QualityGovernor {
+public:
+    static QualityGovernor& getInstance();
+
+    // Time spent on one frame's update and draw, excluding the wait for display
+    void reportFrame(float workMs);
+
+    void reset();
+
+    const QualitySettings& getSettings() const;
+    int getLevel() const { return level_; }
+    float getAverageMs() const { return averageMs_; }
+
+private:
+    QualityGovernor();
+
+    int level_;            // 0 = full quality
+    float averageMs_;
+    int slowFrames_;       // Consecutive frames over budget
+    int fastFrames_;       // Consecutive frames with plenty of headroom
+};
@@ -0,0 +1,142 @@
+#include "render_queue.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+    constexpr std::size_t INITIAL_ENTRIES = 4096;
+    constexpr int LAYER_SHIFT = 28;           // Top four bits hold the layer
+    constexpr float Y_KEY_OFFSET = 8192.0f;   // Keeps Y slightly above the world's top edge positive
+    constexpr float Y_KEY_SCALE = 16.0f;      // 1/16 px resolution
+    constexpr std::uint32_t Y_KEY_MAX = (1u << LAYER_SHIFT) - 1;
+}
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+RenderQueue::RenderQueue() : drawCalls_(0) {
+    // Sized for a crowded screen up front so steady-state frames don't allocate
+    entries_.reserve(INITIAL_ENTRIES);
+    keys_.reserve(INITIAL_ENTRIES);
+    order_.reserve(INITIAL_ENTRIES);
+    keyScratch_.reserve(INITIAL_ENTRIES);
+    orderScratch_.reserve(INITIAL_ENTRIES);
+    quads_.reserve(INITIAL_ENTRIES * 4);
+    batch_.reserve(INITIAL_ENTRIES * 4);
+}
+
+void RenderQueue::begin() {
+    entries_.clear();
+    keys_.clear();
+    quads_.clear();
+}
+
+std::uint32_t RenderQueue::makeKey(RenderLayer layer, float sortY) {
+    float scaled = (sortY + Y_KEY_OFFSET) * Y_KEY_SCALE;
+    std::uint32_t y = scaled <= 0.0f ? 0u
+                    : scaled >= static_cast<float>(Y_KEY_MAX) ? Y_KEY_MAX
+                    : static_cast<std::uint32_t>(scaled);
+    return (static_cast<std::uint32_t>(layer) << LAYER_SHIFT) | y;
+}
+
+void RenderQueue::submit(const sf::Sprite& sprite, RenderLayer layer) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    const sf::IntRect& rect = sprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    float u0 = static_cast<float>(rect.left);
+    float v0 = static_cast<float>(rect.top);
+    float u1 = u0 + static_cast<float>(rect.width);
+    float v1 = v0 + static_cast<float>(rect.height);
+
+    const sf::Transform& transform = sprite.getTransform();
+    sf::Color color = sprite.getColor();
+    std::uint32_t first = static_cast<std::uint32_t>(quads_.size());
+    quads_.emplace_back(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(u0, v0));
+    quads_.emplace_back(transform.transformPoint(width, 0.0f), color, sf::Vector2f(u1, v0));
+    quads_.emplace_back(transform.transformPoint(width, height), color, sf::Vector2f(u1, v1));
+    quads_.emplace_back(transform.transformPoint(0.0f, height), color, sf::Vector2f(u0, v1));
+
+    // Sort on the lowest corner, i.e. where the sprite meets the ground
+    float bottom = quads_[first].position.y;
+    for (std::uint32_t v = first + 1; v < first + 4; ++v) {
+        bottom = std::max(bottom, quads_[v].position.y);
+    }
+
+    entries_.push_back(Entry{texture, nullptr, first});
+    keys_.push_back(makeKey(layer, bottom));
+}
+
+void RenderQueue::submit(const sf::Drawable& drawable, float sortY, RenderLayer layer) {
+    entries_.push_back(Entry{nullptr, &drawable, 0});
+    keys_.push_back(makeKey(layer, sortY));
+}
+
+void RenderQueue::sort() {
+    // LSD radix sort on 8-bit digits. Each pass is stable, so objects with
+    // equal keys keep their submission order (a label submitted after its
+    // coin stays on top of it). Passes where every key has the same digit
+    // are skipped, which is most of the top byte.
+    std::size_t count = keys_.size();
+    order_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        order_[i] = static_cast<std::uint32_t>(i);
+    }
+    keyScratch_.resize(count);
+    orderScratch_.resize(count);
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        std::uint32_t histogram[256] = {};
+        for (std::size_t i = 0; i < count; ++i) {
+            ++histogram[(keys_[i] >> shift) & 0xFF];
+        }
+        if (histogram[(keys_[0] >> shift) & 0xFF] == count) continue;
+
+        std::uint32_t offset = 0;
+        for (std::uint32_t& bucket : histogram) {
+            std::uint32_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint32_t slot = histogram[(keys_[i] >> shift) & 0xFF]++;
+            keyScratch_[slot] = keys_[i];
+            orderScratch_[slot] = order_[i];
+        }
+        keys_.swap(keyScratch_);
+        order_.swap(orderScratch_);
+    }
+}
+
+void RenderQueue::drawBatch(sf::RenderTarget& target, const sf::Texture* texture) {
+    if (batch_.empty()) return;
+    target.draw(batch_.data(), batch_.size(), sf::Quads, sf::RenderStates(texture));
+    batch_.clear();
+    ++drawCalls_;
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    drawCalls_ = 0;
+    if (entries_.empty()) return;
+    sort();
+
+    const sf::Texture* batchTexture = nullptr;
+    for (std::uint32_t index : order_) {
+        const Entry& entry = entries_[index];
+        if (entry.drawable) {
+            drawBatch(target, batchTexture);
+            target.draw(*entry.drawable);
+            ++drawCalls_;
+            continue;
+        }
+        if (entry.texture != batchTexture) {
+            drawBatch(target, batchTexture);
+            batchTexture = entry.texture;
+        }
+        batch_.insert(batch_.end(), quads_.begin() + entry.firstVertex, quads_.begin() + entry.firstVertex + 4);
+    }
+    drawBatch(target, batchTexture);
+}
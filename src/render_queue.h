@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Coarse draw order; within a layer, lower on screen draws later (in front)
+enum class RenderLayer : std::uint8_t {
+    GROUND,    // Decals and markers lying flat on the ground
+    ACTORS,    // Player, enemies, pickups, buildings
+    OVERHEAD,  // Labels floating above actors
+    COUNT
+};
+
+// Depth-sorted drawing for world objects. Everything is submitted with a
+// key of (layer, Y of the object's base), the keys are radix sorted once
+// per frame, and flush() walks the result in order.
+//
+// Sprites are baked into textured quads at submit time, so a temporary
+// sprite can be submitted. Consecutive sprite quads with the same texture
+// go out as a single draw call. Other drawables are kept by reference, so
+// they must outlive flush(); each one is its own draw call and ends the
+// current batch.
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();
+
+    void begin();
+
+    void submit(const sf::Sprite& sprite, RenderLayer layer);
+    void submit(const sf::Drawable& drawable, float sortY, RenderLayer layer);
+
+    void flush(sf::RenderTarget& target);
+
+    std::size_t getSubmittedCount() const { return entries_.size(); }
+    int getDrawCallCount() const { return drawCalls_; }
+
+private:
+    RenderQueue();
+
+    struct Entry {
+        const sf::Texture* texture;    // Sprite quads
+        const sf::Drawable* drawable;  // Everything else
+        std::uint32_t firstVertex;
+    };
+
+    static std::uint32_t makeKey(RenderLayer layer, float sortY);
+    void sort();
+    void drawBatch(sf::RenderTarget& target, const sf::Texture* texture);
+
+    std::vector<Entry> entries_;
+    std::vector<std::uint32_t> keys_;
+    std::vector<std::uint32_t> order_;      // Entry indices, sorted by key
+    std::vector<std::uint32_t> keyScratch_;
+    std::vector<std::uint32_t> orderScratch_;
+    std::vector<sf::Vertex> quads_;         // Four per sprite entry, in submission order
+    std::vector<sf::Vertex> batch_;         // Quads of the batch being built
+    int drawCalls_;
+};
@@ -0,0 +1,56 @@
+#include "separation.h"
+#include "config.h"
+#include "enemy.h"
+#include "parallel_for.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::size_t MIN_CHUNK = 256;  // Below this, threading costs more than it saves
+}
+
+void applySeparation(const SpatialGrid& grid, float deltaTime) {
+    const float radius = Config::SEPARATION_RADIUS;
+    const float inverseRadius = 1.0f / radius;
+    const float maxStep = Config::SEPARATION_STRENGTH * deltaTime;
+
+    // Reads only the grid's captured positions and writes only the chunk's
+    // own enemies, so chunks never touch shared state
+    ParallelFor::getInstance().run(grid.getItemCount(), MIN_CHUNK, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t item = begin; item < end; ++item) {
+            Enemy* enemy = grid.getEnemy(item);
+            if (!enemy->isAlive()) continue;
+
+            sf::Vector2f self = grid.getPosition(item);
+            float pushX = 0.0f;
+            float pushY = 0.0f;
+            // Neighbours just across the world's edge push too, the short way
+            sf::FloatRect reach(self.x - radius, self.y - radius, 2.0f * radius, 2.0f * radius);
+            forEachWorldImage(reach, [&](const sf::Vector2f& shift) {
+                grid.queryRadius(self + shift, radius, [&](std::size_t other, float distSq) {
+                    if (other == item) return;
+
+                    sf::Vector2f away = wrappedDelta(grid.getPosition(other), self);
+                    float dist = std::sqrt(distSq);
+                    float weight = 1.0f - dist * inverseRadius;
+                    if (dist > 0.001f) {
+                        pushX += away.x / dist * weight;
+                        pushY += away.y / dist * weight;
+                    } else {
+                        // Exactly stacked: split them along an axis picked by index
+                        pushX += other < item ? 1.0f : -1.0f;
+                    }
+                });
+            });
+
+            float length = std::sqrt(pushX * pushX + pushY * pushY);
+            if (length <= 0.0f) continue;
+
+            // Full overlap pushes at maxStep; several neighbours don't stack past it
+            float step = std::min(length, 1.0f) * maxStep / length;
+            enemy->displace(sf::Vector2f(pushX * step, pushY * step));
+        }
+    });
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+class SpatialGrid;
+
+// Anti-stacking steering: every enemy is pushed away from neighbours within
+// Config::SEPARATION_RADIUS, harder the more they overlap. Neighbours come
+// from the grid, so the pass is O(enemies); it runs in parallel chunks over
+// grid items. Call after enemies have moved and before the grid is rebuilt.
+void applySeparation(const SpatialGrid& grid, float deltaTime);
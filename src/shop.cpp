@@ -1,11 +1,15 @@
 #include "shop.h"
+#include "asset_bundle.h"
 #include "player.h"
+#include "render_queue.h"
 #include "config.h"
+#include "text_format.h"
+#include "frame_arena.h"
 #include "weapons/weapon_factory.h"
 #include "weapon_tier_system.h"
 #include <random>
 #include <cmath>
-#include <sstream>
+#include <cstdio>
 
 Shop::Shop() : 
     visible_(true), teleportTimer_(0.0f), teleportCooldown_(150.0f), // Random between 120-180
@@ -22,7 +26,7 @@ Shop::Shop() :
     generateRandomTeleportLocation();
     
     // Load font
-    if (!font_.loadFromFile("ARIAL.TTF")) {
+    if (!loadFontAsset(font_, "assets/ARIAL.TTF")) {
         // Handle font loading error
     }
     
@@ -107,29 +111,28 @@ void Shop::update(float deltaTime, const Player& player) {
     shopText_.setPosition(position_.x, position_.y - 50.0f);
 }
 
-void Shop::draw(sf::RenderWindow& window) const {
+void Shop::submit(RenderQueue& queue) const {
     if (!visible_) return;
     
-    // Draw range indicator
-    window.draw(rangeIndicator_);
+    // Range indicator lies on the ground under everything
+    queue.submit(rangeIndicator_, position_.y, RenderLayer::GROUND);
     
-    // Draw shop
-    window.draw(shopShape_);
-    window.draw(shopText_);
+    // Shop sorts by its base like any other actor
+    float sortY = position_.y + shopShape_.getSize().y / 2.0f;
+    queue.submit(shopShape_, sortY, RenderLayer::ACTORS);
+    queue.submit(shopText_, sortY, RenderLayer::ACTORS);
     
-    // Draw timer
-    drawTimer(window);
+    submitTimer(queue);
     
-    // Draw warning if needed
+    // Warning if needed
     if (showWarning_) {
         sf::FloatRect warningBounds = warningText_.getLocalBounds();
         sf::Vector2f warningPos = position_;
         warningPos.y -= 80.0f;
         warningPos.x -= warningBounds.width / 2.0f;
         
-        sf::Text warningCopy = warningText_;
-        warningCopy.setPosition(warningPos);
-        window.draw(warningCopy);
+        warningText_.setPosition(warningPos);
+        queue.submit(warningText_, position_.y, RenderLayer::OVERHEAD);
     }
     
     // Note: Shop UI is drawn separately in main.cpp in UI view
@@ -219,28 +222,24 @@ void Shop::updateTimer(float deltaTime) {
     }
 }
 
-void Shop::drawTimer(sf::RenderWindow& window) const {
+void Shop::submitTimer(RenderQueue& queue) const {
     float timeRemaining = teleportCooldown_ - teleportTimer_;
     
-    std::stringstream ss;
     if (timeRemaining > 60.0f) {
         int minutes = static_cast<int>(timeRemaining) / 60;
         int seconds = static_cast<int>(timeRemaining) % 60;
-        ss << "Next teleport: " << minutes << ":" << (seconds < 10 ? "0" : "") << seconds;
+        setTextFormatted(timerText_, timerBuffer_, "Next teleport: %d:%02d", minutes, seconds);
     } else {
-        ss << "Teleporting in: " << static_cast<int>(timeRemaining) << "s";
+        setTextFormatted(timerText_, timerBuffer_, "Teleporting in: %ds", static_cast<int>(timeRemaining));
     }
     
-    sf::Text timerCopy = timerText_;
-    timerCopy.setString(ss.str());
-    
-    sf::FloatRect timerBounds = timerCopy.getLocalBounds();
+    sf::FloatRect timerBounds = timerText_.getLocalBounds();
     sf::Vector2f timerPos = position_;
     timerPos.y += 60.0f;
     timerPos.x -= timerBounds.width / 2.0f;
-    timerCopy.setPosition(timerPos);
+    timerText_.setPosition(timerPos);
     
-    window.draw(timerCopy);
+    queue.submit(timerText_, position_.y, RenderLayer::OVERHEAD);
 }
 
 void Shop::initializeInventory() {
@@ -301,32 +300,29 @@ void Shop::drawShopUI(sf::RenderWindow& window) const {
     window.draw(uiCopy);
     
     // Draw category header
-    sf::Text categoryCopy = categoryText_;
-    std::vector<std::string> categories = {"WEAPONS", "TALENTS", "UPGRADES"};
-    categoryCopy.setString(categories[selectedCategory_]);
-    categoryCopy.setPosition(uiPos.x + 20.0f, uiPos.y + 20.0f);
-    window.draw(categoryCopy);
+    static const char* const categories[] = {"WEAPONS", "TALENTS", "UPGRADES"};
+    setTextString(categoryText_, uiBuffer_, categories[selectedCategory_]);
+    categoryText_.setPosition(uiPos.x + 20.0f, uiPos.y + 20.0f);
+    window.draw(categoryText_);
     
     // Draw item list
-    sf::Text itemCopy = itemListText_;
-    itemCopy.setString(formatItemList());
-    itemCopy.setPosition(uiPos.x + 20.0f, uiPos.y + 60.0f);
-    window.draw(itemCopy);
+    setTextString(itemListText_, uiBuffer_, formatItemList().c_str());
+    itemListText_.setPosition(uiPos.x + 20.0f, uiPos.y + 60.0f);
+    window.draw(itemListText_);
     
     // Draw details
-    sf::Text detailsCopy = detailsText_;
-    detailsCopy.setString(formatItemDetails());
-    detailsCopy.setPosition(uiPos.x + 320.0f, uiPos.y + 60.0f);
-    window.draw(detailsCopy);
+    setTextString(detailsText_, uiBuffer_, formatItemDetails().c_str());
+    detailsText_.setPosition(uiPos.x + 320.0f, uiPos.y + 60.0f);
+    window.draw(detailsText_);
     
     // Draw instructions
-    sf::Text instructionsCopy = instructionsText_;
-    instructionsCopy.setPosition(uiPos.x + 20.0f, uiPos.y + 360.0f);
-    window.draw(instructionsCopy);
+    instructionsText_.setPosition(uiPos.x + 20.0f, uiPos.y + 360.0f);
+    window.draw(instructionsText_);
 }
 
-std::string Shop::formatItemList() const {
-    std::stringstream ss;
+std::pmr::string Shop::formatItemList() const {
+    std::pmr::string list(&FrameArena::getInstance());
+    char cost[32];
     
     const std::vector<ShopItem>* currentItems = nullptr;
     
@@ -338,19 +334,19 @@ std::string Shop::formatItemList() const {
     
     if (currentItems) {
         for (size_t i = 0; i < currentItems->size(); ++i) {
-            if (static_cast<int>(i) == selectedItem_) {
-                ss << "> ";
-            } else {
-                ss << "  ";
-            }
-            ss << (*currentItems)[i].name << " - " << (*currentItems)[i].cost << " gold\n";
+            list += static_cast<int>(i) == selectedItem_ ? "> " : "  ";
+            list += (*currentItems)[i].name;
+            std::snprintf(cost, sizeof(cost), " - %d gold\n", (*currentItems)[i].cost);
+            list += cost;
         }
     }
     
-    return ss.str();
+    return list;
 }
 
-std::string Shop::formatItemDetails() const {
+std::pmr::string Shop::formatItemDetails() const {
+    std::pmr::string details(&FrameArena::getInstance());
+
     const std::vector<ShopItem>* currentItems = nullptr;
     
     switch (selectedCategory_) {
@@ -361,14 +357,19 @@ std::string Shop::formatItemDetails() const {
     
     if (currentItems && selectedItem_ >= 0 && selectedItem_ < static_cast<int>(currentItems->size())) {
         const ShopItem& item = (*currentItems)[selectedItem_];
-        std::stringstream ss;
-        ss << "Name: " << item.name << "\n\n";
-        ss << "Description:\n" << item.description << "\n\n";
-        ss << "Cost: " << item.cost << " gold";
-        return ss.str();
+        char cost[32];
+        std::snprintf(cost, sizeof(cost), "Cost: %d gold", item.cost);
+        details += "Name: ";
+        details += item.name;
+        details += "\n\nDescription:\n";
+        details += item.description;
+        details += "\n\n";
+        details += cost;
+        return details;
     }
     
-    return "No item selected";
+    details = "No item selected";
+    return details;
 }
 
 void Shop::handleCategoryChange(int direction) {
@@ -2,12 +2,14 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include "weapon_tier_system.h"
 
 class Player;
 class Weapon;
 class Talent;
+class RenderQueue;
 
 enum class ItemType {
     WEAPON,
@@ -33,7 +35,7 @@ public:
     Shop();
     
     void update(float deltaTime, const Player& player);
-    void draw(sf::RenderWindow& window) const;
+    void submit(RenderQueue& queue) const;
     void drawUI(sf::RenderWindow& window) const;
     void handleInput(sf::Event& event, Player& player);
     
@@ -60,8 +62,9 @@ private:
     sf::RectangleShape shopShape_;
     sf::CircleShape rangeIndicator_;
     sf::Text shopText_;
-    sf::Text timerText_;
-    sf::Text warningText_;
+    mutable sf::Text timerText_;      // Reformatted in place while submitting
+    mutable sf::String timerBuffer_;
+    mutable sf::Text warningText_;
     sf::Font font_;
     
     // Shop inventory
@@ -76,21 +79,23 @@ private:
     
     // UI components
     sf::RectangleShape uiBackground_;
-    sf::Text categoryText_;
-    sf::Text itemListText_;
-    sf::Text detailsText_;
-    sf::Text instructionsText_;
+    mutable sf::Text categoryText_;
+    mutable sf::Text itemListText_;
+    mutable sf::Text detailsText_;
+    mutable sf::Text instructionsText_;
+    mutable sf::String uiBuffer_;
     
     // Private methods
     void initializeInventory();
     void generateRandomTeleportLocation();
     void drawShopUI(sf::RenderWindow& window) const;
-    void drawTimer(sf::RenderWindow& window) const;
+    void submitTimer(RenderQueue& queue) const;
     void updateTimer(float deltaTime);
     bool purchaseItem(const ShopItem& item, Player& player);
     void refreshItemList();
-    std::string formatItemList() const;
-    std::string formatItemDetails() const;
+    // Built in the frame arena; only valid until the end of the tick
+    std::pmr::string formatItemList() const;
+    std::pmr::string formatItemDetails() const;
     
     // Input handling
     void handleCategoryChange(int direction);
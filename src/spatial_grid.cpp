@@ -0,0 +1,63 @@
+#include "spatial_grid.h"
+#include "config.h"
+#include "enemy.h"
+
+SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float cellSize) :
+    cellSize_(cellSize),
+    inverseCellSize_(1.0f / cellSize),
+    columns_(std::max(1, static_cast<int>(std::ceil(worldWidth / cellSize)))),
+    rows_(std::max(1, static_cast<int>(std::ceil(worldHeight / cellSize)))) {
+    cellStart_.assign(static_cast<std::size_t>(columns_ * rows_ + 1), 0);
+    cellCursor_.assign(static_cast<std::size_t>(columns_ * rows_), 0);
+}
+
+void SpatialGrid::rebuild(const std::vector<std::unique_ptr<Enemy>>& enemies) {
+    std::fill(cellStart_.begin(), cellStart_.end(), 0);
+    itemCell_.resize(enemies.size());
+
+    // Count enemies per cell; counts land one slot ahead for the prefix sum
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        if (!enemies[i]->isAlive()) {
+            itemCell_[i] = -1;
+            continue;
+        }
+        sf::Vector2f pos = enemies[i]->getWorldPosition();
+        int cell = getCellY(pos.y) * columns_ + getCellX(pos.x);
+        itemCell_[i] = cell;
+        cellStart_[cell + 1]++;
+        total++;
+    }
+
+    for (std::size_t cell = 1; cell < cellStart_.size(); ++cell) {
+        cellStart_[cell] += cellStart_[cell - 1];
+    }
+
+    // Scatter into cell order
+    std::copy(cellStart_.begin(), cellStart_.end() - 1, cellCursor_.begin());
+    items_.resize(total);
+    itemX_.resize(total);
+    itemY_.resize(total);
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        int cell = itemCell_[i];
+        if (cell < 0) continue;
+
+        int slot = cellCursor_[cell]++;
+        sf::Vector2f pos = enemies[i]->getWorldPosition();
+        items_[slot] = enemies[i].get();
+        itemX_[slot] = pos.x;
+        itemY_[slot] = pos.y;
+    }
+}
+
+void SpatialGrid::clear() {
+    std::fill(cellStart_.begin(), cellStart_.end(), 0);
+    items_.clear();
+    itemX_.clear();
+    itemY_.clear();
+}
+
+SpatialGrid& getEnemyGrid() {
+    static SpatialGrid grid(Config::WORLD_WIDTH, Config::WORLD_HEIGHT, Config::SPATIAL_GRID_CELL_SIZE);
+    return grid;
+}
@@ -0,0 +1,297 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "world_wrap.h"
+
+class Enemy;
+
+// Uniform grid over the world, rebuilt from scratch each tick with a
+// counting sort: one pass to count enemies per cell, a prefix sum, and one
+// pass to scatter them. Items in a cell are contiguous, so queries walk a
+// handful of short runs instead of the whole enemy list.
+//
+// Items are numbered 0..getItemCount()-1 in cell order; systems that need
+// per-enemy scratch (damage accumulators and so on) can index dense arrays
+// by item. Positions are captured at rebuild time. Enemy pointers are only
+// valid until dead enemies are erased, so rebuild after that step.
+class SpatialGrid {
+public:
+    SpatialGrid(float worldWidth, float worldHeight, float cellSize);
+
+    // Index every alive enemy
+    void rebuild(const std::vector<std::unique_ptr<Enemy>>& enemies);
+    void clear();
+
+    std::size_t getItemCount() const { return items_.size(); }
+    Enemy* getEnemy(std::size_t item) const { return items_[item]; }
+    sf::Vector2f getPosition(std::size_t item) const { return sf::Vector2f(itemX_[item], itemY_[item]); }
+
+    int getColumns() const { return columns_; }
+    int getRows() const { return rows_; }
+    float getCellSize() const { return cellSize_; }
+    int getCellX(float x) const { return clampColumn(static_cast<int>(std::floor(x * inverseCellSize_))); }
+    int getCellY(float y) const { return clampRow(static_cast<int>(std::floor(y * inverseCellSize_))); }
+
+    // Calls fn(item, distanceSquared) for every item within radius of center
+    template <typename Fn>
+    void queryRadius(const sf::Vector2f& center, float radius, Fn&& fn) const {
+        const float radiusSq = radius * radius;
+        int minX = getCellX(center.x - radius);
+        int maxX = getCellX(center.x + radius);
+        int minY = getCellY(center.y - radius);
+        int maxY = getCellY(center.y + radius);
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                int cell = cy * columns_ + cx;
+                for (int item = cellStart_[cell]; item < cellStart_[cell + 1]; ++item) {
+                    float dx = itemX_[item] - center.x;
+                    float dy = itemY_[item] - center.y;
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq <= radiusSq) {
+                        fn(static_cast<std::size_t>(item), distSq);
+                    }
+                }
+            }
+        }
+    }
+
+    // Calls fn(item) for every item whose position lies inside rect
+    template <typename Fn>
+    void queryRect(const sf::FloatRect& rect, Fn&& fn) const {
+        float right = rect.left + rect.width;
+        float bottom = rect.top + rect.height;
+        int minX = getCellX(rect.left);
+        int maxX = getCellX(right);
+        int minY = getCellY(rect.top);
+        int maxY = getCellY(bottom);
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                int cell = cy * columns_ + cx;
+                for (int item = cellStart_[cell]; item < cellStart_[cell + 1]; ++item) {
+                    float x = itemX_[item];
+                    float y = itemY_[item];
+                    if (x >= rect.left && x <= right && y >= rect.top && y <= bottom) {
+                        fn(static_cast<std::size_t>(item));
+                    }
+                }
+            }
+        }
+    }
+
+    // Nearest item within maxRadius of center for which accept(item) is true,
+    // or -1. Searches square rings of cells outwards from the centre cell and
+    // stops as soon as no farther ring can hold anything closer.
+    template <typename Accept>
+    long findNearest(const sf::Vector2f& center, float maxRadius, Accept&& accept) const {
+        long best = -1;
+        float bestDistSq = maxRadius * maxRadius;
+        int originX = getCellX(center.x);
+        int originY = getCellY(center.y);
+        int maxRing = static_cast<int>(std::ceil(maxRadius * inverseCellSize_));
+
+        for (int ring = 0; ring <= maxRing; ++ring) {
+            int minX = originX - ring;
+            int maxX = originX + ring;
+            int minY = originY - ring;
+            int maxY = originY + ring;
+            for (int cy = std::max(minY, 0); cy <= std::min(maxY, rows_ - 1); ++cy) {
+                // Interior rows of the ring only contribute their two end cells
+                bool edgeRow = (cy == minY || cy == maxY);
+                int step = edgeRow ? 1 : std::max(maxX - minX, 1);
+                for (int cx = minX; cx <= maxX; cx += step) {
+                    if (cx < 0 || cx >= columns_) continue;
+                    int cell = cy * columns_ + cx;
+                    for (int item = cellStart_[cell]; item < cellStart_[cell + 1]; ++item) {
+                        float dx = itemX_[item] - center.x;
+                        float dy = itemY_[item] - center.y;
+                        float distSq = dx * dx + dy * dy;
+                        if (distSq <= bestDistSq && accept(static_cast<std::size_t>(item))) {
+                            best = item;
+                            bestDistSq = distSq;
+                        }
+                    }
+                }
+            }
+
+            // Everything in the next ring is at least this far away
+            float ringDistance = ring * cellSize_;
+            if (best >= 0 && bestDistSq <= ringDistance * ringDistance) break;
+        }
+        return best;
+    }
+
+    // findNearest on the wrapped world: when the radius hangs over an edge,
+    // the copy of the world across it is searched too
+    template <typename Accept>
+    long findNearestWrapped(const sf::Vector2f& center, float maxRadius, Accept&& accept) const {
+        long best = -1;
+        float bestDistSq = std::numeric_limits<float>::max();
+        sf::FloatRect reach(center.x - maxRadius, center.y - maxRadius, 2.0f * maxRadius, 2.0f * maxRadius);
+        forEachWorldImage(reach, [&](const sf::Vector2f& shift) {
+            sf::Vector2f shifted = center + shift;
+            long item = findNearest(shifted, maxRadius, accept);
+            if (item < 0) return;
+            float dx = itemX_[item] - shifted.x;
+            float dy = itemY_[item] - shifted.y;
+            float distSq = dx * dx + dy * dy;
+            if (distSq < bestDistSq) {
+                best = item;
+                bestDistSq = distSq;
+            }
+        });
+        return best;
+    }
+
+    // Calls fn(item) for every item in one cell; coordinates must be in range
+    template <typename Fn>
+    void forEachInCell(int cx, int cy, Fn&& fn) const {
+        int cell = cy * columns_ + cx;
+        for (int item = cellStart_[cell]; item < cellStart_[cell + 1]; ++item) {
+            fn(static_cast<std::size_t>(item));
+        }
+    }
+
+    // Walks the cells crossed by a segment in order (Amanatides-Woo DDA) and
+    // calls fn(cx, cy, tEnter), where tEnter is the distance along the ray at
+    // which it enters the cell. direction must be normalised. A ray starting
+    // outside the grid is walked from where it enters. Stops at the end of
+    // the segment or where it leaves the grid.
+    template <typename Fn>
+    void forEachCellOnRay(const sf::Vector2f& rayOrigin, const sf::Vector2f& direction, float length, Fn&& fn) const {
+        const float infinity = std::numeric_limits<float>::max();
+        float tStart = 0.0f;
+        float tEnd = length;
+        if (!clipRay(rayOrigin.x, direction.x, columns_ * cellSize_, tStart, tEnd) ||
+            !clipRay(rayOrigin.y, direction.y, rows_ * cellSize_, tStart, tEnd)) {
+            return;
+        }
+        sf::Vector2f origin = rayOrigin + direction * tStart;
+        int cx = getCellX(origin.x);
+        int cy = getCellY(origin.y);
+        int stepX = direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0);
+        int stepY = direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0);
+
+        // Distance along the ray to the next vertical/horizontal cell border
+        float tMaxX = infinity;
+        float tMaxY = infinity;
+        float tDeltaX = infinity;
+        float tDeltaY = infinity;
+        if (stepX != 0) {
+            float border = (stepX > 0 ? cx + 1 : cx) * cellSize_;
+            tMaxX = tStart + (border - origin.x) / direction.x;
+            tDeltaX = cellSize_ / std::fabs(direction.x);
+        }
+        if (stepY != 0) {
+            float border = (stepY > 0 ? cy + 1 : cy) * cellSize_;
+            tMaxY = tStart + (border - origin.y) / direction.y;
+            tDeltaY = cellSize_ / std::fabs(direction.y);
+        }
+
+        float tEnter = tStart;
+        while (true) {
+            fn(cx, cy, tEnter);
+
+            if (tMaxX < tMaxY) {
+                tEnter = tMaxX;
+                cx += stepX;
+                tMaxX += tDeltaX;
+            } else {
+                tEnter = tMaxY;
+                cy += stepY;
+                tMaxY += tDeltaY;
+            }
+            if (tEnter > length || cx < 0 || cx >= columns_ || cy < 0 || cy >= rows_) break;
+        }
+    }
+
+    // Swept circle test: calls fn(item, t) for every item a circle of the
+    // given radius touches while moving from start to end, where t in [0, 1]
+    // is the fraction of the move at first contact. Only the cells along the
+    // segment (padded by the radius) are visited; an item can be reported
+    // more than once, so callers should keep the minimum t.
+    template <typename Fn>
+    void querySegment(const sf::Vector2f& start, const sf::Vector2f& end, float radius, Fn&& fn) const {
+        const float radiusSq = radius * radius;
+        sf::Vector2f delta = end - start;
+        float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+        if (length < 0.0001f) {
+            queryRadius(start, radius, [&](std::size_t item, float) { fn(item, 0.0f); });
+            return;
+        }
+        sf::Vector2f direction = delta / length;
+        const float inverseLength = 1.0f / length;
+        const float cellSpan = cellSize_ * 1.415f;  // Longest path through one cell
+
+        forEachCellOnRay(start, direction, length, [&](int, int, float tEnter) {
+            // Bounding box of the part of the segment in this cell, padded
+            float tExit = std::min(tEnter + cellSpan, length);
+            sf::Vector2f a = start + direction * tEnter;
+            sf::Vector2f b = start + direction * tExit;
+            int minX = getCellX(std::min(a.x, b.x) - radius);
+            int maxX = getCellX(std::max(a.x, b.x) + radius);
+            int minY = getCellY(std::min(a.y, b.y) - radius);
+            int maxY = getCellY(std::max(a.y, b.y) + radius);
+
+            for (int cy = minY; cy <= maxY; ++cy) {
+                for (int cx = minX; cx <= maxX; ++cx) {
+                    int cell = cy * columns_ + cx;
+                    for (int item = cellStart_[cell]; item < cellStart_[cell + 1]; ++item) {
+                        // Solve |start + direction * t - item|^2 = radius^2
+                        float fx = start.x - itemX_[item];
+                        float fy = start.y - itemY_[item];
+                        float c = fx * fx + fy * fy - radiusSq;
+                        if (c <= 0.0f) {
+                            fn(static_cast<std::size_t>(item), 0.0f);
+                            continue;
+                        }
+                        float b = fx * direction.x + fy * direction.y;
+                        if (b >= 0.0f) continue;  // Moving away
+                        float discriminant = b * b - c;
+                        if (discriminant < 0.0f) continue;
+                        float t = -b - std::sqrt(discriminant);
+                        if (t <= length) {
+                            fn(static_cast<std::size_t>(item), t * inverseLength);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+private:
+    float cellSize_;
+    float inverseCellSize_;
+    int columns_;
+    int rows_;
+
+    std::vector<int> cellStart_;    // Prefix sums, size columns*rows + 1
+    std::vector<int> itemCell_;     // Cell of each enemy during the scatter pass
+    std::vector<int> cellCursor_;   // Next free slot per cell during the scatter pass
+    std::vector<Enemy*> items_;     // Sorted by cell
+    std::vector<float> itemX_;
+    std::vector<float> itemY_;
+
+    // Narrows [tStart, tEnd] to where the ray is within [0, extent] on one
+    // axis; false if that leaves nothing
+    static bool clipRay(float origin, float direction, float extent, float& tStart, float& tEnd) {
+        if (direction == 0.0f) return origin >= 0.0f && origin <= extent;
+        float t0 = -origin / direction;
+        float t1 = (extent - origin) / direction;
+        if (t0 > t1) std::swap(t0, t1);
+        tStart = std::max(tStart, t0);
+        tEnd = std::min(tEnd, t1);
+        return tStart <= tEnd;
+    }
+
+    int clampColumn(int cx) const { return std::min(std::max(cx, 0), columns_ - 1); }
+    int clampRow(int cy) const { return std::min(std::max(cy, 0), rows_ - 1); }
+};
+
+// Grid of the current enemies, rebuilt by the game loop every tick
+SpatialGrid& getEnemyGrid();
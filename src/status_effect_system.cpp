@@ -0,0 +1,144 @@
+#include "status_effect_system.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::size_t INITIAL_CAPACITY = 1024;
+
+    bool dealsDamage(StatusEffect effect) {
+        return effect == StatusEffect::BURN || effect == StatusEffect::POISON;
+    }
+}
+
+StatusEffectSystem& StatusEffectSystem::getInstance() {
+    static StatusEffectSystem instance;
+    return instance;
+}
+
+StatusEffectSystem::StatusEffectSystem() {
+    enemy_.reserve(INITIAL_CAPACITY);
+    type_.reserve(INITIAL_CAPACITY);
+    magnitude_.reserve(INITIAL_CAPACITY);
+    damagePerSecond_.reserve(INITIAL_CAPACITY);
+    remaining_.reserve(INITIAL_CAPACITY);
+    accumulator_.reserve(INITIAL_CAPACITY);
+}
+
+void StatusEffectSystem::apply(Enemy* enemy, StatusEffect effect, float magnitude, float duration) {
+    if (!enemy->isAlive()) return;
+
+    int slot = enemy->getStatusSlot(static_cast<int>(effect));
+    if (slot >= 0) {
+        magnitude_[slot] = std::max(magnitude_[slot], magnitude);
+        remaining_[slot] = std::max(remaining_[slot], duration);
+    } else {
+        enemy->setStatusSlot(static_cast<int>(effect), static_cast<int>(enemy_.size()));
+        enemy_.push_back(enemy);
+        type_.push_back(effect);
+        magnitude_.push_back(magnitude);
+        damagePerSecond_.push_back(0.0f);
+        remaining_.push_back(duration);
+        accumulator_.push_back(0.0f);
+        slot = static_cast<int>(enemy_.size()) - 1;
+    }
+
+    if (dealsDamage(effect)) {
+        damagePerSecond_[slot] = magnitude_[slot];
+    } else {
+        refreshSpeed(enemy);
+    }
+}
+
+void StatusEffectSystem::tick(float deltaTime) {
+    std::size_t count = enemy_.size();
+    if (count == 0) return;
+
+    // Branch-free pass over the timers and accumulators
+    for (std::size_t i = 0; i < count; ++i) {
+        remaining_[i] -= deltaTime;
+        accumulator_[i] += damagePerSecond_[i] * deltaTime;
+    }
+
+    // Deal whole points of damage; the fraction carries to the next tick.
+    // Ticks are quiet so burning crowds don't flood the hit numbers.
+    for (std::size_t i = 0; i < count; ++i) {
+        if (accumulator_[i] < 1.0f) continue;
+        float whole = std::floor(accumulator_[i]);
+        accumulator_[i] -= whole;
+        enemy_[i]->takeTickDamage(static_cast<int>(whole));
+    }
+
+    // Drop expired effects and everything on enemies that just died
+    std::size_t i = 0;
+    while (i < enemy_.size()) {
+        if (!enemy_[i]->isAlive()) {
+            removeEnemy(enemy_[i]);
+        } else if (remaining_[i] <= 0.0f) {
+            Enemy* enemy = enemy_[i];
+            bool movement = !dealsDamage(type_[i]);
+            remove(i);
+            if (movement) refreshSpeed(enemy);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void StatusEffectSystem::removeEnemy(Enemy* enemy) {
+    for (int effect = 0; effect < static_cast<int>(StatusEffect::COUNT); ++effect) {
+        int slot = enemy->getStatusSlot(effect);
+        if (slot >= 0) {
+            remove(static_cast<std::size_t>(slot));
+        }
+    }
+    enemy->setSpeedMultiplier(1.0f);
+}
+
+void StatusEffectSystem::clear() {
+    // Enemies can outlive a restart, so detach them before the arrays go
+    for (std::size_t i = 0; i < enemy_.size(); ++i) {
+        enemy_[i]->setStatusSlot(static_cast<int>(type_[i]), -1);
+        enemy_[i]->setSpeedMultiplier(1.0f);
+    }
+    enemy_.clear();
+    type_.clear();
+    magnitude_.clear();
+    damagePerSecond_.clear();
+    remaining_.clear();
+    accumulator_.clear();
+}
+
+void StatusEffectSystem::remove(std::size_t index) {
+    enemy_[index]->setStatusSlot(static_cast<int>(type_[index]), -1);
+
+    // Fill the hole with the last effect and tell its enemy where it went
+    std::size_t last = enemy_.size() - 1;
+    if (index != last) {
+        enemy_[index] = enemy_[last];
+        type_[index] = type_[last];
+        magnitude_[index] = magnitude_[last];
+        damagePerSecond_[index] = damagePerSecond_[last];
+        remaining_[index] = remaining_[last];
+        accumulator_[index] = accumulator_[last];
+        enemy_[index]->setStatusSlot(static_cast<int>(type_[index]), static_cast<int>(index));
+    }
+
+    enemy_.pop_back();
+    type_.pop_back();
+    magnitude_.pop_back();
+    damagePerSecond_.pop_back();
+    remaining_.pop_back();
+    accumulator_.pop_back();
+}
+
+void StatusEffectSystem::refreshSpeed(Enemy* enemy) const {
+    float multiplier = 1.0f;
+    int slow = enemy->getStatusSlot(static_cast<int>(StatusEffect::SLOW));
+    if (slow >= 0) {
+        multiplier = std::max(0.0f, 1.0f - magnitude_[slow]);
+    }
+    if (enemy->getStatusSlot(static_cast<int>(StatusEffect::FREEZE)) >= 0) {
+        multiplier = 0.0f;
+    }
+    enemy->setSpeedMultiplier(multiplier);
+}
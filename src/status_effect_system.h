@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include "enemy.h"
+
+enum class StatusEffect {
+    BURN,    // Damage over time, magnitude = damage per second
+    POISON,  // Damage over time, magnitude = damage per second
+    SLOW,    // Movement, magnitude = fraction of speed removed (0..1)
+    FREEZE,  // Movement stopped entirely; magnitude unused
+    COUNT
+};
+
+static_assert(static_cast<int>(StatusEffect::COUNT) == Enemy::STATUS_SLOT_COUNT,
+              "Enemy needs one status slot per effect type");
+
+// Active status effects for every enemy, stored in dense parallel arrays.
+// An enemy has at most one effect of each type; reapplying refreshes it.
+// Each enemy records the array index of its effects, so applying and
+// removing are O(1) and nothing is allocated per effect.
+//
+// tick() runs one flat pass over the timers and damage accumulators, then
+// applies whole points of damage and drops expired effects.
+class StatusEffectSystem {
+public:
+    static StatusEffectSystem& getInstance();
+
+    // Stronger magnitude and longer duration win when refreshing
+    void apply(Enemy* enemy, StatusEffect effect, float magnitude, float duration);
+
+    // Advance all effects and deal their damage. Effects on enemies that
+    // die here are removed, so no effect outlives its enemy's erase.
+    void tick(float deltaTime);
+
+    // Drop every effect on an enemy (call before erasing it)
+    void removeEnemy(Enemy* enemy);
+
+    void clear();
+    std::size_t getActiveCount() const { return enemy_.size(); }
+
+private:
+    StatusEffectSystem();
+
+    void remove(std::size_t index);
+    void refreshSpeed(Enemy* enemy) const;
+
+    std::vector<Enemy*> enemy_;
+    std::vector<StatusEffect> type_;
+    std::vector<float> magnitude_;
+    std::vector<float> damagePerSecond_;  // magnitude for damage types, 0 otherwise
+    std::vector<float> remaining_;
+    std::vector<float> accumulator_;      // Fractional damage carried between ticks
+};
@@ -1,4 +1,6 @@
 #include "talent.h"
+#include "asset_bundle.h"
+#include "log.h"
 #include "player.h"
 #include "talents/talent_factory.h"
 #include <cmath>
@@ -75,7 +77,7 @@ sf::Color Talent::getRarityColor() const {
 
 void Talent::loadFont() const {
     if (!fontLoaded_) {
-        if (font_.loadFromFile("ARIAL.TTF")) {
+        if (loadFontAsset(font_, "assets/ARIAL.TTF")) {
             fontLoaded_ = true;
         }
     }
@@ -202,8 +204,8 @@ void TalentTree::clear() {
     nodes_.clear();
 }
 
-std::vector<int> TalentTree::getAvailableTalents() const {
-    std::vector<int> available;
+void TalentTree::getAvailableTalents(std::pmr::vector<int>& available) const {
+    available.clear();
     
     for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
         const auto& node = nodes_[i];
@@ -213,8 +215,15 @@ std::vector<int> TalentTree::getAvailableTalents() const {
             available.push_back(i);
         }
     }
-    
-    return available;
+}
+
+bool TalentTree::hasAvailableTalents() const {
+    for (const auto& node : nodes_) {
+        if (node.isUnlocked && !node.isSelected) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool TalentTree::selectTalent(int nodeIndex, Player& player) {
@@ -238,19 +247,14 @@ bool TalentTree::selectTalent(int nodeIndex, Player& player) {
     int column = nodeIndex / ROWS;
     int row = nodeIndex % ROWS;
     
-    // Debug output (can be removed later)
-    #ifdef DEBUG_TALENTS
-    std::cout << "Selected talent " << nodeIndex << " (Col " << column << ", Row " << row << ")" << std::endl;
-    #endif
+    LOG_TRACE("Selected talent %d (Col %d, Row %d)", nodeIndex, column, row);
     
     // If this is not the bottom row, unlock the next talent in this column
     if (row < ROWS - 1) {
         int nextTalentIndex = column * ROWS + (row + 1);
         if (nextTalentIndex < static_cast<int>(nodes_.size())) {
             nodes_[nextTalentIndex].isUnlocked = true;
-            #ifdef DEBUG_TALENTS
-            std::cout << "Unlocked next talent " << nextTalentIndex << std::endl;
-            #endif
+            LOG_TRACE("Unlocked next talent %d", nextTalentIndex);
         }
     }
     
@@ -260,7 +264,7 @@ bool TalentTree::selectTalent(int nodeIndex, Player& player) {
 void TalentTree::draw(sf::RenderWindow& window, const sf::Vector2f& offset) const {
     // Draw column headers first
     sf::Font font;
-    bool fontLoaded = font.loadFromFile("ARIAL.TTF");
+    bool fontLoaded = loadFontAsset(font, "assets/ARIAL.TTF");
     
     if (fontLoaded) {
         std::string headers[3] = {"COMBAT", "DEFENSIVE", "UTILITY"};
@@ -296,11 +300,9 @@ void TalentTree::draw(sf::RenderWindow& window, const sf::Vector2f& offset) cons
     drawConnections(window, offset);
     
     // Draw talent nodes
-    auto available = getAvailableTalents();
-    
     for (int i = 0; i < static_cast<int>(nodes_.size()); i++) {
         const auto& node = nodes_[i];
-        bool isAvailable = std::find(available.begin(), available.end(), i) != available.end();
+        bool isAvailable = node.isUnlocked && !node.isSelected;
         
         if (node.talent) {
             sf::Vector2f drawPos = node.position + offset;
@@ -437,8 +439,8 @@ void TalentTree::validateTree() {
         const auto& node = nodes_[i];
         int col = i / ROWS;
         int row = i % ROWS;
-        std::cout << "Talent " << i << " (Col " << col << ", Row " << row << ") (" << node.talent->getName() << "): ";
-        std::cout << "Unlocked: " << (node.isUnlocked ? "YES" : "NO") << std::endl;
+        LOG_TRACE("Talent %d (Col %d, Row %d) (%s): Unlocked: %s", i, col, row,
+                  node.talent->getName().c_str(), node.isUnlocked ? "YES" : "NO");
     }
     #endif
 }
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <memory_resource>
 
 // Forward declarations
 class Player;
@@ -89,7 +90,9 @@ public:
     void clear();
 
     // Talent selection
-    std::vector<int> getAvailableTalents() const;
+    // Fills the caller's vector; pass one backed by the frame arena
+    void getAvailableTalents(std::pmr::vector<int>& available) const;
+    bool hasAvailableTalents() const;
     bool selectTalent(int nodeIndex, Player& player);
     
     // Tree management
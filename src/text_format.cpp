@@ -0,0 +1,25 @@
+#include "text_format.h"
+#include <cstdarg>
+#include <cstdio>
+
+void setTextFormatted(sf::Text& text, sf::String& buffer, const char* format, ...) {
+    char formatted[768];  // Fits the debug overlay
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(formatted, sizeof(formatted), format, args);
+    va_end(args);
+
+    setTextString(text, buffer, formatted);
+}
+
+void setTextString(sf::Text& text, sf::String& buffer, const char* str) {
+    // Append one code point at a time: a single character fits in the
+    // temporary's small-string storage, and clear() keeps the capacity
+    buffer.clear();
+    for (const char* c = str; *c != '\0'; ++c) {
+        buffer += sf::String(static_cast<sf::Uint32>(static_cast<unsigned char>(*c)));
+    }
+
+    // No-op when unchanged, so the glyph geometry is only rebuilt on change
+    text.setString(buffer);
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "log.h"
+
+// printf-style update of an sf::Text. The string is rebuilt inside the
+// caller's buffer, so once the buffer and the text's geometry have grown to
+// size, refreshing a HUD line each frame does not touch the heap.
+void setTextFormatted(sf::Text& text, sf::String& buffer, const char* format, ...) ESTATE_PRINTF_FORMAT(3, 4);
+
+// Same, for text that is already built (any length)
+void setTextString(sf::Text& text, sf::String& buffer, const char* str);
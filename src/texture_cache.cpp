@@ -0,0 +1,46 @@
+#include "texture_cache.h"
+#include "asset_bundle.h"
+#include "log.h"
+#include <cstdio>
+
+TextureCache& TextureCache::getInstance() {
+    static TextureCache instance;
+    return instance;
+}
+
+const sf::Texture* TextureCache::get(const std::string& path) {
+    auto it = textures_.find(path);
+    if (it != textures_.end()) {
+        return it->second.get();
+    }
+
+    auto texture = std::make_unique<sf::Texture>();
+    if (!loadTextureAsset(*texture, path)) {
+        LOG_WARNING("Failed to load texture: %s", path.c_str());
+        texture.reset();
+    }
+    const sf::Texture* result = texture.get();
+    textures_.emplace(path, std::move(texture));
+    return result;
+}
+
+const sf::Texture* TextureCache::getSolid(unsigned width, unsigned height, const sf::Color& color) {
+    // Keys can't collide with file paths
+    char key[64];
+    std::snprintf(key, sizeof(key), "#solid:%ux%u:%02x%02x%02x%02x", width, height,
+                  color.r, color.g, color.b, color.a);
+    auto it = textures_.find(key);
+    if (it != textures_.end()) {
+        return it->second.get();
+    }
+
+    sf::Image image;
+    image.create(width, height, color);
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->loadFromImage(image)) {
+        texture.reset();
+    }
+    const sf::Texture* result = texture.get();
+    textures_.emplace(key, std::move(texture));
+    return result;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// One sf::Texture per image, shared by every object that uses it. Sprites
+// that share a texture can go in one render-queue batch, and spawning an
+// entity no longer decodes and uploads its image again.
+class TextureCache {
+public:
+    static TextureCache& getInstance();
+
+    // nullptr if the image can't be loaded; failures are remembered too
+    const sf::Texture* get(const std::string& path);
+
+    // Plain coloured rectangle, for entities whose image is missing
+    const sf::Texture* getSolid(unsigned width, unsigned height, const sf::Color& color);
+
+private:
+    TextureCache() = default;
+
+    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures_;
+};
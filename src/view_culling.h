@@ -0,0 +1,11 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// World rectangle shown by a view, grown by margin on every side. Draw
+// passes test against this so off-screen entities are never submitted.
+inline sf::FloatRect getCullRect(const sf::View& view, float margin) {
+    sf::Vector2f center = view.getCenter();
+    sf::Vector2f size = view.getSize();
+    return sf::FloatRect(center.x - size.x * 0.5f - margin, center.y - size.y * 0.5f - margin,
+                         size.x + 2.0f * margin, size.y + 2.0f * margin);
+}
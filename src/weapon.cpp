@@ -1,12 +1,17 @@
 #include "weapon.h"
 #include "enemy.h"
 #include "player.h"
+#include "projectile_system.h"
+#include "spatial_grid.h"
+#include "world_wrap.h"
+#include "debug_draw.h"
 #include <cmath>
-#include <algorithm>
 
 // Base Weapon implementation
 Weapon::Weapon(Type type, int damage, float cooldown, float range)
     : type_(type), damage_(damage), cooldown_(cooldown), range_(range), cooldownTimer_(0.0f) {
+    static std::uint32_t nextId = 1;
+    id_ = nextId++;
 }
 
 bool Weapon::hasEnemiesInRange(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies) const {
@@ -15,13 +20,14 @@ bool Weapon::hasEnemiesInRange(const sf::Vector2f& playerPos, const std::vector<
 
 Enemy* Weapon::findClosestEnemy(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies) const {
     Enemy* closestEnemy = nullptr;
-    float closestDistance = range_;
+    float closestDistanceSq = range_ * range_;
 
+    // Squared and wrap-aware, so targets just over the world's edge count
     for (const auto& enemy : enemies) {
         if (enemy->isAlive()) {
-            float distance = getDistance(playerPos, enemy->getWorldPosition());
-            if (distance < closestDistance) {
-                closestDistance = distance;
+            float distanceSq = wrappedDistanceSq(playerPos, enemy->getWorldPosition());
+            if (distanceSq < closestDistanceSq) {
+                closestDistanceSq = distanceSq;
                 closestEnemy = enemy.get();
             }
         }
@@ -30,10 +36,16 @@ Enemy* Weapon::findClosestEnemy(const sf::Vector2f& playerPos, const std::vector
     return closestEnemy;
 }
 
+Enemy* Weapon::findClosestInGrid(const sf::Vector2f& playerPos) const {
+    const SpatialGrid& grid = getEnemyGrid();
+    long item = grid.findNearestWrapped(playerPos, range_, [&grid](std::size_t candidate) {
+        return grid.getEnemy(candidate)->isAlive();
+    });
+    return item >= 0 ? grid.getEnemy(static_cast<std::size_t>(item)) : nullptr;
+}
+
 float Weapon::getDistance(const sf::Vector2f& pos1, const sf::Vector2f& pos2) const {
-    float dx = pos1.x - pos2.x;
-    float dy = pos1.y - pos2.y;
-    return std::sqrt(dx * dx + dy * dy);
+    return std::sqrt(wrappedDistanceSq(pos1, pos2));
 }
 
 // MeleeWeapon implementation
@@ -64,7 +76,7 @@ void MeleeWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::u
         cooldownTimer_ = modifiedCooldown;
         
         // Calculate swing direction based on closest enemy
-        swingDirection_ = closestTarget->getWorldPosition() - playerPos;
+        swingDirection_ = wrappedDelta(playerPos, closestTarget->getWorldPosition());
         float length = std::sqrt(swingDirection_.x * swingDirection_.x + swingDirection_.y * swingDirection_.y);
         if (length > 0.0f) {
             swingDirection_ /= length; // Normalize
@@ -77,8 +89,9 @@ void MeleeWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::u
                 float distance = getDistance(playerPos, enemy->getWorldPosition());
                 if (distance <= range_) {
                     // Calculate modified damage using player's talents
-                    int modifiedDamage = player ? player->calculateModifiedDamage(damage_) : damage_;
-                    enemy->takeDamage(modifiedDamage);
+                    bool critical = false;
+                    int modifiedDamage = player ? player->calculateModifiedDamage(damage_, &critical) : damage_;
+                    enemy->takeDamage(modifiedDamage, critical);
                     totalDamageDealt += modifiedDamage;
                 }
             }
@@ -92,14 +105,8 @@ void MeleeWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::u
 }
 
 void MeleeWeapon::draw(sf::RenderWindow& window, const sf::Vector2f& playerPos) const {
-    // Draw range circle
-    sf::CircleShape rangeCircle(range_);
-    rangeCircle.setFillColor(sf::Color::Transparent);
-    rangeCircle.setOutlineThickness(2.0f);
-    rangeCircle.setOutlineColor(sf::Color(100, 100, 255, 80));
-    rangeCircle.setOrigin(range_, range_);
-    rangeCircle.setPosition(playerPos);
-    window.draw(rangeCircle);
+    // Range circle is a debug aid, batched with the rest of the debug layer
+    DebugDraw::getInstance().circle(playerPos, range_, sf::Color(100, 100, 255, 80));
     
     if (isSwinging_) {
         // Draw swing arc
@@ -137,7 +144,7 @@ std::string MeleeWeapon::getName() const {
 
 // RangedWeapon implementation
 RangedWeapon::RangedWeapon(int damage, float cooldown, float range, float projectileSpeed)
-    : Weapon(Type::RANGED, damage, cooldown, range), projectileSpeed_(projectileSpeed) {
+    : Weapon(Type::RANGED, damage, cooldown, range), projectileSpeed_(projectileSpeed), projectileLifetime_(3.0f) {
 }
 
 bool RangedWeapon::canAttack(float deltaTime, const Player* player) {
@@ -153,7 +160,7 @@ void RangedWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::
     Enemy* target = findClosestEnemy(playerPos, enemies);
     if (target) {
         // Calculate projectile direction
-        sf::Vector2f direction = target->getWorldPosition() - playerPos;
+        sf::Vector2f direction = wrappedDelta(playerPos, target->getWorldPosition());
         float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         
         if (length > 0.0f) {
@@ -161,7 +168,7 @@ void RangedWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::
             
             // Create projectile
             sf::Vector2f velocity = direction * projectileSpeed_;
-            projectiles_.emplace_back(playerPos, velocity);
+            ProjectileSystem::getInstance().spawn(playerPos, velocity, getProjectileSpec());
             
             // Apply attack speed modifier from talents
             float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
@@ -170,75 +177,23 @@ void RangedWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::
     }
 }
 
-void RangedWeapon::draw(sf::RenderWindow& window, const sf::Vector2f& playerPos) const {
-    // Draw range circle
-    sf::CircleShape rangeCircle(range_);
-    rangeCircle.setFillColor(sf::Color::Transparent);
-    rangeCircle.setOutlineThickness(2.0f);
-    rangeCircle.setOutlineColor(sf::Color(100, 100, 255, 80));
-    rangeCircle.setOrigin(range_, range_);
-    rangeCircle.setPosition(playerPos);
-    window.draw(rangeCircle);
-    
-    // Draw projectiles
-    for (const auto& projectile : projectiles_) {
-        if (projectile.active) {
-            sf::CircleShape projectileShape(3.0f);
-            projectileShape.setFillColor(sf::Color::Yellow);
-            projectileShape.setOrigin(3.0f, 3.0f);
-            projectileShape.setPosition(projectile.position);
-            window.draw(projectileShape);
-        }
-    }
+ProjectileSpec RangedWeapon::getProjectileSpec() const {
+    ProjectileSpec spec;
+    spec.damage = damage_;
+    spec.lifetime = projectileLifetime_;
+    spec.ownerId = id_;
+    return spec;
+}
+
+void RangedWeapon::draw(sf::RenderWindow&, const sf::Vector2f& playerPos) const {
+    // Range circle is a debug aid, batched with the rest of the debug layer
+    DebugDraw::getInstance().circle(playerPos, range_, sf::Color(100, 100, 255, 80));
 }
 
-void RangedWeapon::update(float deltaTime) {
-    updateProjectiles(deltaTime, std::vector<std::unique_ptr<Enemy>>{}); // Empty vector for now
+void RangedWeapon::update(float) {
+    // Cooldown ticks in canAttack; projectiles advance in ProjectileSystem
 }
 
 std::string RangedWeapon::getName() const {
     return "Ranged Weapon";
 }
-
-void RangedWeapon::updateProjectiles(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player) {
-    for (auto& projectile : projectiles_) {
-        if (projectile.active) {
-            // Update position
-            projectile.position += projectile.velocity * deltaTime;
-            
-            // Update lifetime
-            projectile.lifetime -= deltaTime;
-            if (projectile.lifetime <= 0.0f) {
-                projectile.active = false;
-                continue;
-            }
-            
-            // Check collision with enemies
-            for (const auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    float distance = getDistance(projectile.position, enemy->getWorldPosition());
-                    if (distance < 20.0f) { // Hit radius
-                        // Calculate modified damage using player's talents
-                        int modifiedDamage = player ? player->calculateModifiedDamage(damage_) : damage_;
-                        enemy->takeDamage(modifiedDamage);
-                        
-                        // Apply life steal if player has it
-                        if (player) {
-                            player->applyLifeSteal(modifiedDamage);
-                        }
-                        
-                        projectile.active = false;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-    
-    // Remove inactive projectiles
-    projectiles_.erase(
-        std::remove_if(projectiles_.begin(), projectiles_.end(),
-            [](const Projectile& p) { return !p.active; }),
-        projectiles_.end()
-    );
-} 
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
+#include "projectile_system.h"
 
 // Forward declarations
 class Enemy;
@@ -28,6 +30,7 @@ public:
 
     // Common weapon properties
     Type getType() const { return type_; }
+    std::uint32_t getId() const { return id_; }  // Unique per instance; tags spawned projectiles
     int getDamage() const { return damage_; }
     float getRange() const { return range_; }
     bool isOnCooldown() const { return cooldownTimer_ > 0.0f; }
@@ -38,11 +41,15 @@ public:
 protected:
     // Helper function to find closest enemy
     Enemy* findClosestEnemy(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies) const;
+
+    // Same target from the enemy grid's ring search, without a scan of every enemy
+    Enemy* findClosestInGrid(const sf::Vector2f& playerPos) const;
     
     // Helper function to calculate distance
     float getDistance(const sf::Vector2f& pos1, const sf::Vector2f& pos2) const;
 
     Type type_;
+    std::uint32_t id_;
     int damage_;
     float cooldown_;
     float range_;
@@ -78,22 +85,11 @@ public:
     void update(float deltaTime) override;
     std::string getName() const override;
 
-    // Public method for updating projectiles with enemy collision
-    void updateProjectiles(float deltaTime, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr);
-
 protected:
-    struct Projectile {
-        sf::Vector2f position;
-        sf::Vector2f velocity;
-        float lifetime;
-        bool active;
-        
-        Projectile(sf::Vector2f pos, sf::Vector2f vel) 
-            : position(pos), velocity(vel), lifetime(3.0f), active(true) {}
-    };
+    // What each shot carries into ProjectileSystem; subclasses add effects
+    virtual ProjectileSpec getProjectileSpec() const;
 
+    // Projectiles are owned by ProjectileSystem, not the weapon
     float projectileSpeed_;
-    std::vector<Projectile> projectiles_;
-    
-    void checkProjectileCollisions(const std::vector<std::unique_ptr<Enemy>>& enemies);
+    float projectileLifetime_;
 }; 
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "weapon_selection.h"
+#include "asset_bundle.h"
 #include "player.h"
 #include <sstream>
 
@@ -6,7 +7,7 @@ WeaponSelection::WeaponSelection() :
     active_(false), selectionComplete_(false), selectedWeapon_(0) {
     
     // Load font
-    if (!font_.loadFromFile("ARIAL.TTF")) {
+    if (!loadFontAsset(font_, "assets/ARIAL.TTF")) {
         // Handle font loading error
     }
     
@@ -1,6 +1,12 @@
 #include "weapon_tier_system.h"
 #include "weapons/melee_weapons.h"
 #include "weapons/ranged_weapons.h"
+#include "weapons/explosive_weapons.h"
+#include "weapons/beam_weapons.h"
+#include "weapons/chain_weapons.h"
+#include "weapons/status_weapons.h"
+#include "weapons/field_weapons.h"
+#include "weapons/swarm_weapons.h"
 #include <stdexcept>
 
 WeaponTierSystem& WeaponTierSystem::getInstance() {
@@ -443,8 +449,83 @@ std::unique_ptr<Weapon> WeaponTierSystem::createWeapon(WeaponCategory category,
         case WeaponCategory::CROSSBOW:
         case WeaponCategory::STAFF:
         case WeaponCategory::WAND:
-        case WeaponCategory::CANNON:
             return std::make_unique<RangedWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange);
+
+        // Area damage: projectile speed, blast radius, falloff at the edge
+        case WeaponCategory::CANNON:
+            return std::make_unique<ExplosiveWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                     350.0f, 70.0f, 0.5f, sf::Color(255, 140, 0), stats.name);
+        case WeaponCategory::ROCKET_LAUNCHER:
+            return std::make_unique<ExplosiveWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                     450.0f, 90.0f, 0.5f, sf::Color(255, 80, 30), stats.name);
+        case WeaponCategory::ANTIMATTER_BOMB:
+            return std::make_unique<ExplosiveWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                     300.0f, 180.0f, 0.7f, sf::Color(200, 80, 255), stats.name);
+
+        // Hitscan: pierce grows with tier, beam width, colour
+        case WeaponCategory::LASER_CANNON:
+            return std::make_unique<BeamWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                2 + 2 * static_cast<int>(tier), 4.0f, sf::Color(255, 60, 60), stats.name);
+        case WeaponCategory::PHOTON_LANCE:
+            return std::make_unique<BeamWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                8 + 8 * static_cast<int>(tier), 6.0f, sf::Color(255, 255, 200), stats.name);
+        case WeaponCategory::QUANTUM_BLASTER:
+            return std::make_unique<BeamWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                BeamWeapon::UNLIMITED_PIERCE, 8.0f, sf::Color(80, 200, 255), stats.name);
+
+        // Chain lightning: jump radius, hops grow with tier, damage lost per hop
+        case WeaponCategory::LIGHTNING_ROD:
+            return std::make_unique<ChainWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 120.0f, 3 + 2 * static_cast<int>(tier), 0.15f,
+                                                 sf::Color(180, 220, 255), stats.name);
+        case WeaponCategory::TESLA_COIL:
+            return std::make_unique<ChainWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 150.0f, 5 + 4 * static_cast<int>(tier), 0.1f,
+                                                 sf::Color(140, 160, 255), stats.name);
+        case WeaponCategory::STORM_HAMMER:
+            // Melee reach for the first strike, then the storm carries on
+            return std::make_unique<ChainWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 100.0f, 2 + static_cast<int>(tier), 0.25f,
+                                                 sf::Color(255, 255, 160), stats.name);
+
+        // Status effects: damage-over-time is per second, slow is the fraction removed
+        case WeaponCategory::FLAMETHROWER:
+            return std::make_unique<StatusWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                  StatusEffect::BURN, stats.baseDamage * 0.5f, 2.0f, stats.name);
+        case WeaponCategory::SOUL_REAPER:
+            return std::make_unique<StatusWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                  StatusEffect::POISON, stats.baseDamage * 0.3f, 4.0f, stats.name);
+        case WeaponCategory::FROSTMOURNE:
+            if (tier == WeaponTier::LEGENDARY) {
+                return std::make_unique<StatusWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                      StatusEffect::FREEZE, 1.0f, 1.0f, stats.name);
+            }
+            return std::make_unique<StatusWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                  StatusEffect::SLOW, 0.4f + 0.2f * static_cast<int>(tier), 2.0f, stats.name);
+
+        // Homing swarms: volley size grows with tier, turn rate, blast radius
+        case WeaponCategory::NANO_SWARM:
+            return std::make_unique<SwarmWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 8 + 8 * static_cast<int>(tier), 8.0f, 0.0f,
+                                                 sf::Color(160, 255, 160), stats.name);
+        case WeaponCategory::SOCK_LAUNCHER:
+            return std::make_unique<SwarmWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 3 + 2 * static_cast<int>(tier), 3.0f, 0.0f,
+                                                 sf::Color(230, 230, 230), stats.name);
+        case WeaponCategory::RUBBER_DUCK_BOMBS:
+            return std::make_unique<SwarmWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 4 + 2 * static_cast<int>(tier), 4.0f, 50.0f,
+                                                 sf::Color(255, 230, 60), stats.name);
+
+        // Force fields: field radius, pull/push speed at the centre, duration
+        case WeaponCategory::GRAVITY_GUN:
+            return std::make_unique<FieldWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 FieldWeapon::Mode::REPULSOR, stats.baseRange * 0.6f,
+                                                 600.0f, 0.3f, stats.name);
+        case WeaponCategory::BLACK_HOLE_GUN:
+            return std::make_unique<FieldWeapon>(stats.baseDamage, stats.baseCooldown, stats.baseRange,
+                                                 FieldWeapon::Mode::ATTRACTOR, 150.0f + 50.0f * static_cast<int>(tier),
+                                                 250.0f, 2.5f, stats.name);
             
         default:
             throw std::invalid_argument("Unknown weapon category");
@@ -0,0 +1,32 @@
+#include "beam_weapons.h"
+#include "../beam_system.h"
+#include "../enemy.h"
+#include "../player.h"
+#include "../spatial_grid.h"
+#include "../world_wrap.h"
+#include <cmath>
+
+BeamWeapon::BeamWeapon(int damage, float cooldown, float range, int pierce, float width,
+                       const sf::Color& color, const std::string& name)
+    : RangedWeapon(damage, cooldown, range), pierce_(pierce), width_(width), color_(color), name_(name) {
+}
+
+void BeamWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>&, Player* player) {
+    if (!canAttack(0.0f, player)) return;
+
+    Enemy* target = findClosestInGrid(playerPos);
+    if (!target) return;
+
+    sf::Vector2f direction = wrappedDelta(playerPos, target->getWorldPosition());
+    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    if (length <= 0.0f) return;
+    direction /= length;
+
+    // The beam always reaches full range, past the enemy it was aimed at
+    BeamSystem::getInstance().fire(playerPos, direction, range_, damage_, pierce_, width_, color_,
+                                   getEnemyGrid(), player);
+
+    // Apply attack speed modifier from talents
+    float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
+    cooldownTimer_ = modifiedCooldown;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "../weapon.h"
+
+// Hitscan weapon: fires an instant beam at the closest enemy that damages
+// everything along its path, up to a pierce limit. Hits are resolved by
+// BeamSystem against the enemy grid.
+class BeamWeapon : public RangedWeapon {
+public:
+    static constexpr int UNLIMITED_PIERCE = -1;
+
+    BeamWeapon(int damage, float cooldown, float range, int pierce, float width,
+               const sf::Color& color, const std::string& name);
+
+    void attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr) override;
+    std::string getName() const override { return name_; }
+    int getPierce() const { return pierce_; }
+
+private:
+    int pierce_;
+    float width_;
+    sf::Color color_;
+    std::string name_;
+};
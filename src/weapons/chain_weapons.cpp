@@ -0,0 +1,23 @@
+#include "chain_weapons.h"
+#include "../lightning_system.h"
+#include "../player.h"
+#include "../spatial_grid.h"
+
+ChainWeapon::ChainWeapon(int damage, float cooldown, float range, float jumpRadius, int maxHops,
+                         float damageFalloff, const sf::Color& color, const std::string& name)
+    : RangedWeapon(damage, cooldown, range), jumpRadius_(jumpRadius), maxHops_(maxHops),
+      damageFalloff_(damageFalloff), color_(color), name_(name) {
+}
+
+void ChainWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>&, Player* player) {
+    if (!canAttack(0.0f, player)) return;
+
+    // The first target comes from the grid as well, so no enemy scan at all
+    int hits = LightningSystem::getInstance().strike(playerPos, range_, jumpRadius_, maxHops_, damage_,
+                                                     damageFalloff_, color_, getEnemyGrid(), player);
+    if (hits == 0) return;
+
+    // Apply attack speed modifier from talents
+    float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
+    cooldownTimer_ = modifiedCooldown;
+}
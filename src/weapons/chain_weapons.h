@@ -0,0 +1,22 @@
+#pragma once
+#include "../weapon.h"
+
+// Chain lightning: strikes the closest enemy in range, then arcs to the
+// nearest enemy not yet hit within the jump radius, up to maxHops times.
+// Resolved by LightningSystem against the enemy grid.
+class ChainWeapon : public RangedWeapon {
+public:
+    ChainWeapon(int damage, float cooldown, float range, float jumpRadius, int maxHops,
+                float damageFalloff, const sf::Color& color, const std::string& name);
+
+    void attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr) override;
+    std::string getName() const override { return name_; }
+    int getMaxHops() const { return maxHops_; }
+
+private:
+    float jumpRadius_;
+    int maxHops_;
+    float damageFalloff_;
+    sf::Color color_;
+    std::string name_;
+};
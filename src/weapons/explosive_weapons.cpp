@@ -0,0 +1,17 @@
+#include "explosive_weapons.h"
+
+ExplosiveWeapon::ExplosiveWeapon(int damage, float cooldown, float range, float projectileSpeed,
+                                 float blastRadius, float blastFalloff, const sf::Color& color, const std::string& name)
+    : RangedWeapon(damage, cooldown, range, projectileSpeed),
+      blastRadius_(blastRadius), blastFalloff_(blastFalloff), color_(color), name_(name) {
+    // Shells go off where they land, so don't let them fly far past the range
+    projectileLifetime_ = range / projectileSpeed;
+}
+
+ProjectileSpec ExplosiveWeapon::getProjectileSpec() const {
+    ProjectileSpec spec = RangedWeapon::getProjectileSpec();
+    spec.color = color_;
+    spec.blastRadius = blastRadius_;
+    spec.blastFalloff = blastFalloff_;
+    return spec;
+}
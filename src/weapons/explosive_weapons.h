@@ -0,0 +1,22 @@
+#pragma once
+#include "../weapon.h"
+
+// Ranged weapon whose shells burst on impact (or at the end of their flight)
+// and damage everything inside the blast radius via ExplosionSystem
+class ExplosiveWeapon : public RangedWeapon {
+public:
+    ExplosiveWeapon(int damage, float cooldown, float range, float projectileSpeed,
+                    float blastRadius, float blastFalloff, const sf::Color& color, const std::string& name);
+
+    std::string getName() const override { return name_; }
+    float getBlastRadius() const { return blastRadius_; }
+
+protected:
+    ProjectileSpec getProjectileSpec() const override;
+
+private:
+    float blastRadius_;
+    float blastFalloff_;
+    sf::Color color_;
+    std::string name_;
+};
@@ -0,0 +1,30 @@
+#include "field_weapons.h"
+#include "../enemy.h"
+#include "../explosion_system.h"
+#include "../force_field_system.h"
+#include "../player.h"
+
+FieldWeapon::FieldWeapon(int damage, float cooldown, float range, Mode mode, float fieldRadius, float strength,
+                         float duration, const std::string& name)
+    : RangedWeapon(damage, cooldown, range), mode_(mode), fieldRadius_(fieldRadius), strength_(strength),
+      duration_(duration), name_(name) {
+}
+
+void FieldWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>&, Player* player) {
+    if (!canAttack(0.0f, player)) return;
+
+    Enemy* target = findClosestInGrid(playerPos);
+    if (!target) return;
+
+    // Damage goes through ExplosionSystem, which applies talents per enemy
+    if (mode_ == Mode::ATTRACTOR) {
+        ForceFieldSystem::getInstance().spawn(target->getWorldPosition(), fieldRadius_, strength_, duration_, damage_);
+    } else {
+        ForceFieldSystem::getInstance().spawn(playerPos, fieldRadius_, -strength_, duration_);
+        ExplosionSystem::getInstance().emit(playerPos, fieldRadius_, damage_, 0.5f, sf::Color(120, 180, 255));
+    }
+
+    // Apply attack speed modifier from talents
+    float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
+    cooldownTimer_ = modifiedCooldown;
+}
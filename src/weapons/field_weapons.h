@@ -0,0 +1,27 @@
+#pragma once
+#include "../weapon.h"
+
+// Weapon that spawns a force field through ForceFieldSystem. An attractor
+// opens on the closest enemy, drags everything around it together and
+// collapses in a blast; a repulsor bursts out from the player and shoves
+// enemies away.
+class FieldWeapon : public RangedWeapon {
+public:
+    enum class Mode {
+        ATTRACTOR,
+        REPULSOR
+    };
+
+    FieldWeapon(int damage, float cooldown, float range, Mode mode, float fieldRadius, float strength,
+                float duration, const std::string& name);
+
+    void attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr) override;
+    std::string getName() const override { return name_; }
+
+private:
+    Mode mode_;
+    float fieldRadius_;
+    float strength_;
+    float duration_;
+    std::string name_;
+};
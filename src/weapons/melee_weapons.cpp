@@ -1,5 +1,6 @@
 #include "melee_weapons.h"
-#include <iostream>
+#include "../asset_bundle.h"
+#include "../log.h"
 #include <cmath>
 
 // Sword implementation
@@ -8,14 +9,14 @@ Sword::Sword() : MeleeWeapon(25, 0.8f, 60.0f, 0.3f), textureLoaded_(false) {
 }
 
 void Sword::loadAssets() {
-    if (weaponTexture_.loadFromFile("assets/weapons/sword.png")) {
+    if (loadTextureAsset(weaponTexture_, "assets/weapons/sword.png")) {
         weaponSprite_.setTexture(weaponTexture_);
         // Center the sprite origin
         sf::FloatRect bounds = weaponSprite_.getLocalBounds();
         weaponSprite_.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
         textureLoaded_ = true;
     } else {
-        std::cout << "Warning: Could not load sword.png asset\n";
+        LOG_WARNING("Could not load sword.png asset");
         textureLoaded_ = false;
     }
 }
@@ -51,14 +52,14 @@ Dagger::Dagger() : MeleeWeapon(15, 0.5f, 45.0f, 0.2f), textureLoaded_(false) {
 }
 
 void Dagger::loadAssets() {
-    if (weaponTexture_.loadFromFile("assets/weapons/dagger.png")) {
+    if (loadTextureAsset(weaponTexture_, "assets/weapons/dagger.png")) {
         weaponSprite_.setTexture(weaponTexture_);
         // Center the sprite origin
         sf::FloatRect bounds = weaponSprite_.getLocalBounds();
         weaponSprite_.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
         textureLoaded_ = true;
     } else {
-        std::cout << "Warning: Could not load dagger.png asset\n";
+        LOG_WARNING("Could not load dagger.png asset");
         textureLoaded_ = false;
     }
 }
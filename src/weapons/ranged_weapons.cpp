@@ -1,5 +1,6 @@
 #include "ranged_weapons.h"
-#include <iostream>
+#include "../asset_bundle.h"
+#include "../log.h"
 #include <cmath>
 
 // Bow implementation
@@ -8,14 +9,14 @@ Bow::Bow() : RangedWeapon(20, 1.0f, 250.0f, 350.0f), textureLoaded_(false) {
 }
 
 void Bow::loadAssets() {
-    if (weaponTexture_.loadFromFile("assets/weapons/bow.png")) {
+    if (loadTextureAsset(weaponTexture_, "assets/weapons/bow.png")) {
         weaponSprite_.setTexture(weaponTexture_);
         // Center the sprite origin
         sf::FloatRect bounds = weaponSprite_.getLocalBounds();
         weaponSprite_.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
         textureLoaded_ = true;
     } else {
-        std::cout << "Warning: Could not load bow.png asset\n";
+        LOG_WARNING("Could not load bow.png asset");
         textureLoaded_ = false;
     }
 }
@@ -46,14 +47,14 @@ Crossbow::Crossbow() : RangedWeapon(35, 1.5f, 300.0f, 500.0f), textureLoaded_(fa
 }
 
 void Crossbow::loadAssets() {
-    if (weaponTexture_.loadFromFile("assets/weapons/crossbow.png")) {
+    if (loadTextureAsset(weaponTexture_, "assets/weapons/crossbow.png")) {
         weaponSprite_.setTexture(weaponTexture_);
         // Center the sprite origin
         sf::FloatRect bounds = weaponSprite_.getLocalBounds();
         weaponSprite_.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
         textureLoaded_ = true;
     } else {
-        std::cout << "Warning: Could not load crossbow.png asset\n";
+        LOG_WARNING("Could not load crossbow.png asset");
         textureLoaded_ = false;
     }
 }
@@ -0,0 +1,64 @@
+#include "status_weapons.h"
+#include "../player.h"
+#include "../spatial_grid.h"
+#include "../world_wrap.h"
+#include <cmath>
+
+StatusWeapon::StatusWeapon(int damage, float cooldown, float range, StatusEffect effect, float magnitude,
+                           float duration, const std::string& name)
+    : MeleeWeapon(damage, cooldown, range), effect_(effect), magnitude_(magnitude), duration_(duration), name_(name) {
+}
+
+void StatusWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>&, Player* player) {
+    if (!canAttack(0.0f, player)) return;
+
+    const SpatialGrid& grid = getEnemyGrid();
+    StatusEffectSystem& effects = StatusEffectSystem::getInstance();
+
+    // Damage-over-time scales with talents like the hit itself, but never crits
+    float magnitude = magnitude_;
+    if ((effect_ == StatusEffect::BURN || effect_ == StatusEffect::POISON) && player) {
+        magnitude = player->calculateSustainedDamage(magnitude_);
+    }
+
+    Enemy* closest = nullptr;
+    float closestDistSq = range_ * range_;
+    int totalDamageDealt = 0;
+    // The swing reaches over the world's edge like the plain melee one
+    sf::FloatRect reach(playerPos.x - range_, playerPos.y - range_, 2.0f * range_, 2.0f * range_);
+    forEachWorldImage(reach, [&](const sf::Vector2f& shift) {
+        grid.queryRadius(playerPos + shift, range_, [&](std::size_t item, float distSq) {
+            Enemy* enemy = grid.getEnemy(item);
+            if (!enemy->isAlive()) return;
+
+            // Each victim gets its own crit roll, as with a plain melee swing
+            bool critical = false;
+            int modifiedDamage = player ? player->calculateModifiedDamage(damage_, &critical) : damage_;
+            enemy->takeDamage(modifiedDamage, critical);
+            effects.apply(enemy, effect_, magnitude, duration_);
+            totalDamageDealt += modifiedDamage;
+            if (distSq <= closestDistSq) {
+                closestDistSq = distSq;
+                closest = enemy;
+            }
+        });
+    });
+    if (!closest) return;
+
+    if (player && totalDamageDealt > 0) {
+        player->applyLifeSteal(totalDamageDealt);
+    }
+
+    // Same swing as a plain melee weapon, aimed at the closest victim
+    isSwinging_ = true;
+    swingTimer_ = swingDuration_;
+    swingDirection_ = wrappedDelta(playerPos, closest->getWorldPosition());
+    float length = std::sqrt(swingDirection_.x * swingDirection_.x + swingDirection_.y * swingDirection_.y);
+    if (length > 0.0f) {
+        swingDirection_ /= length;
+    }
+
+    // Apply attack speed modifier from talents
+    float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
+    cooldownTimer_ = modifiedCooldown;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "../weapon.h"
+#include "../status_effect_system.h"
+
+// Melee-range weapon that hits every enemy around the player and leaves a
+// status effect on each one (burning, poisoned, slowed or frozen)
+class StatusWeapon : public MeleeWeapon {
+public:
+    StatusWeapon(int damage, float cooldown, float range, StatusEffect effect, float magnitude,
+                 float duration, const std::string& name);
+
+    void attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr) override;
+    std::string getName() const override { return name_; }
+    StatusEffect getEffect() const { return effect_; }
+
+private:
+    StatusEffect effect_;
+    float magnitude_;
+    float duration_;
+    std::string name_;
+};
@@ -0,0 +1,51 @@
+#include "swarm_weapons.h"
+#include "../enemy.h"
+#include "../player.h"
+#include "../world_wrap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float SPREAD = 1.6f;  // Radians covered by a volley
+}
+
+SwarmWeapon::SwarmWeapon(int damage, float cooldown, float range, int volleySize, float homingRate,
+                         float blastRadius, const sf::Color& color, const std::string& name)
+    : RangedWeapon(damage, cooldown, range, 300.0f), volleySize_(std::max(1, volleySize)), homingRate_(homingRate),
+      blastRadius_(blastRadius), color_(color), name_(name) {
+    projectileLifetime_ = 2.5f;
+}
+
+ProjectileSpec SwarmWeapon::getProjectileSpec() const {
+    ProjectileSpec spec = RangedWeapon::getProjectileSpec();
+    // Not every missile connects, so a volley carries twice the listed damage
+    spec.damage = std::max(1, damage_ * 2 / volleySize_);
+    spec.color = color_;
+    spec.homingRate = homingRate_;
+    spec.blastRadius = blastRadius_;
+    spec.blastFalloff = 0.5f;
+    return spec;
+}
+
+void SwarmWeapon::attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>&, Player* player) {
+    if (!canAttack(0.0f, player)) return;
+
+    Enemy* target = findClosestInGrid(playerPos);
+    if (!target) return;
+
+    sf::Vector2f toTarget = wrappedDelta(playerPos, target->getWorldPosition());
+    float baseAngle = std::atan2(toTarget.y, toTarget.x);
+    ProjectileSpec spec = getProjectileSpec();
+    ProjectileSystem& projectiles = ProjectileSystem::getInstance();
+
+    for (int i = 0; i < volleySize_; ++i) {
+        float offset = volleySize_ > 1 ? SPREAD * (static_cast<float>(i) / (volleySize_ - 1) - 0.5f) : 0.0f;
+        float angle = baseAngle + offset;
+        sf::Vector2f velocity(std::cos(angle) * projectileSpeed_, std::sin(angle) * projectileSpeed_);
+        projectiles.spawn(playerPos, velocity, spec);
+    }
+
+    // Apply attack speed modifier from talents
+    float modifiedCooldown = player ? player->calculateModifiedCooldown(cooldown_) : cooldown_;
+    cooldownTimer_ = modifiedCooldown;
+}
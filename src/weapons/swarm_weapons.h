@@ -0,0 +1,25 @@
+#pragma once
+#include "../weapon.h"
+
+// Fires a volley of small homing projectiles fanned out around the closest
+// enemy. Each one seeks its own nearest target once launched, so a volley
+// spreads through a crowd. Optional blast radius for explosive swarms.
+class SwarmWeapon : public RangedWeapon {
+public:
+    SwarmWeapon(int damage, float cooldown, float range, int volleySize, float homingRate,
+                float blastRadius, const sf::Color& color, const std::string& name);
+
+    void attack(const sf::Vector2f& playerPos, const std::vector<std::unique_ptr<Enemy>>& enemies, Player* player = nullptr) override;
+    std::string getName() const override { return name_; }
+    int getVolleySize() const { return volleySize_; }
+
+protected:
+    ProjectileSpec getProjectileSpec() const override;
+
+private:
+    int volleySize_;
+    float homingRate_;
+    float blastRadius_;
+    sf::Color color_;
+    std::string name_;
+};
@@ -0,0 +1,63 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "config.h"
+#include <cmath>
+
+// The world wraps at its edges, so the shortest way between two points may
+// cross a seam. These give the shortest vector on the wrapped world.
+
+inline float wrappedAxisDelta(float from, float to, float size) {
+    float delta = to - from;
+    if (delta > size * 0.5f) delta -= size;
+    else if (delta < -size * 0.5f) delta += size;
+    return delta;
+}
+
+inline sf::Vector2f wrappedDelta(const sf::Vector2f& from, const sf::Vector2f& to) {
+    return sf::Vector2f(wrappedAxisDelta(from.x, to.x, Config::WORLD_WIDTH),
+                        wrappedAxisDelta(from.y, to.y, Config::WORLD_HEIGHT));
+}
+
+// Bring a point that stepped over an edge back onto the world
+inline sf::Vector2f wrapWorldPosition(sf::Vector2f position) {
+    if (position.x < 0.0f) position.x += Config::WORLD_WIDTH;
+    else if (position.x >= Config::WORLD_WIDTH) position.x -= Config::WORLD_WIDTH;
+    if (position.y < 0.0f) position.y += Config::WORLD_HEIGHT;
+    else if (position.y >= Config::WORLD_HEIGHT) position.y -= Config::WORLD_HEIGHT;
+    return position;
+}
+
+inline float wrappedDistanceSq(const sf::Vector2f& a, const sf::Vector2f& b) {
+    sf::Vector2f delta = wrappedDelta(a, b);
+    return delta.x * delta.x + delta.y * delta.y;
+}
+
+// Overlap test for two boxes that may sit on either side of a seam
+inline bool wrappedIntersects(const sf::FloatRect& a, const sf::FloatRect& b) {
+    sf::Vector2f centerA(a.left + a.width * 0.5f, a.top + a.height * 0.5f);
+    sf::Vector2f centerB(b.left + b.width * 0.5f, b.top + b.height * 0.5f);
+    sf::Vector2f delta = wrappedDelta(centerA, centerB);
+    return std::fabs(delta.x) * 2.0f < a.width + b.width && std::fabs(delta.y) * 2.0f < a.height + b.height;
+}
+
+// Calls fn(shift) for every copy of the world that bounds overlaps. A query
+// moved by shift sees the items of that copy at their real positions, so
+// geometry hanging over an edge is tested against what lies across it.
+// (0, 0) always comes first; near a corner there are four calls.
+template <typename Fn>
+void forEachWorldImage(const sf::FloatRect& bounds, Fn&& fn) {
+    float shiftX[2] = {0.0f, 0.0f};
+    float shiftY[2] = {0.0f, 0.0f};
+    int countX = 1;
+    int countY = 1;
+    if (bounds.left < 0.0f) shiftX[countX++] = Config::WORLD_WIDTH;
+    else if (bounds.left + bounds.width > Config::WORLD_WIDTH) shiftX[countX++] = -Config::WORLD_WIDTH;
+    if (bounds.top < 0.0f) shiftY[countY++] = Config::WORLD_HEIGHT;
+    else if (bounds.top + bounds.height > Config::WORLD_HEIGHT) shiftY[countY++] = -Config::WORLD_HEIGHT;
+
+    for (int y = 0; y < countY; ++y) {
+        for (int x = 0; x < countX; ++x) {
+            fn(sf::Vector2f(shiftX[x], shiftY[y]));
+        }
+    }
+}
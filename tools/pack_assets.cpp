@@ -0,0 +1,190 @@
+// Build step that packs the assets directory into a single assets.pak.
+// Images are decoded once here and stored as LZ4-compressed RGBA, so the game
+// only has to inflate LZ4 and upload at startup.
+//
+// Usage: estate_pack <assets_dir> <output.pak>
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "asset_bundle.h"
+#include "lz4_block.h"
+
+namespace fs = std::filesystem;
+
+struct PendingFile {
+    fs::path file;
+    std::string key;
+    bool image;
+};
+
+static bool isImageFile(const std::string& extension) {
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+           extension == ".bmp" || extension == ".tga";
+}
+
+static bool isRawFile(const std::string& extension) {
+    return extension == ".ttf" || extension == ".otf";
+}
+
+static std::string lowercase(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+static bool readFile(const fs::path& file, std::vector<char>& bytes) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <assets_dir> <output.pak>" << std::endl;
+        return 1;
+    }
+
+    fs::path assetsDir = argv[1];
+    fs::path outputFile = argv[2];
+
+    if (!fs::is_directory(assetsDir)) {
+        std::cerr << "Not a directory: " << assetsDir << std::endl;
+        return 1;
+    }
+
+    // Collect files in a stable order so the bundle is reproducible
+    std::vector<fs::path> files;
+    for (const auto& item : fs::recursive_directory_iterator(assetsDir)) {
+        if (item.is_regular_file()) {
+            files.push_back(item.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<PendingFile> pending;
+    for (const auto& file : files) {
+        std::string extension = lowercase(file.extension().string());
+        bool image = isImageFile(extension);
+        if (!image && !isRawFile(extension)) {
+            continue;
+        }
+
+        // Keys match the paths the game passes to the loaders
+        std::string key = "assets/" + fs::relative(file, assetsDir).generic_string();
+        if (key.size() >= AssetPak::MAX_PATH_LENGTH) {
+            std::cerr << "Skipping asset with path too long: " << key << std::endl;
+            continue;
+        }
+        pending.push_back({file, key, image});
+    }
+
+    std::ofstream out(outputFile, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Cannot write " << outputFile << std::endl;
+        return 1;
+    }
+
+    // Reserve the header and an index slot per candidate; both are filled in
+    // once the blobs are written. Assets that fail to load leave a spare slot.
+    auto align = [](std::uint64_t value) {
+        return (value + AssetPak::BLOB_ALIGNMENT - 1) & ~static_cast<std::uint64_t>(AssetPak::BLOB_ALIGNMENT - 1);
+    };
+    std::uint64_t offset = align(sizeof(AssetPak::Header) + pending.size() * sizeof(AssetPak::Entry));
+    std::vector<char> reserved(static_cast<std::size_t>(offset), 0);
+    out.write(reserved.data(), static_cast<std::streamsize>(reserved.size()));
+
+    // Each asset is loaded, compressed and written before the next one is
+    // touched, so only one decoded image is held at a time
+    std::vector<AssetPak::Entry> entries;
+    entries.reserve(pending.size());
+    std::vector<char> bytes;
+    std::vector<unsigned char> compressed;
+    std::uint64_t rawTotal = 0;
+    static const char padding[AssetPak::BLOB_ALIGNMENT] = {};
+
+    for (const auto& item : pending) {
+        AssetPak::Entry entry;
+        std::memset(&entry, 0, sizeof(entry));
+        std::memcpy(entry.path, item.key.c_str(), item.key.size());
+        entry.compression = static_cast<std::uint32_t>(AssetPak::Compression::NONE);
+
+        const char* blob = nullptr;
+        std::size_t blobSize = 0;
+        sf::Image decoded;
+
+        if (item.image) {
+            if (!decoded.loadFromFile(item.file.string())) {
+                std::cerr << "Skipping undecodable image: " << item.file << std::endl;
+                continue;
+            }
+            sf::Vector2u size = decoded.getSize();
+            const unsigned char* pixels = decoded.getPixelsPtr();
+            std::size_t pixelBytes = static_cast<std::size_t>(size.x) * size.y * 4;
+            entry.kind = static_cast<std::uint32_t>(AssetPak::EntryKind::IMAGE_RGBA);
+            entry.width = size.x;
+            entry.height = size.y;
+            entry.rawSize = pixelBytes;
+
+            // Keep the raw pixels if LZ4 can't shrink them
+            compressed.resize(Lz4::compressBound(pixelBytes));
+            std::size_t packedSize = Lz4::compress(pixels, pixelBytes, compressed.data(), compressed.size());
+            if (packedSize > 0 && packedSize < pixelBytes) {
+                entry.compression = static_cast<std::uint32_t>(AssetPak::Compression::LZ4);
+                blob = reinterpret_cast<const char*>(compressed.data());
+                blobSize = packedSize;
+            } else {
+                blob = reinterpret_cast<const char*>(pixels);
+                blobSize = pixelBytes;
+            }
+        } else {
+            // Fonts are read lazily from the mapping, so they stay uncompressed
+            if (!readFile(item.file, bytes)) {
+                std::cerr << "Skipping unreadable file: " << item.file << std::endl;
+                continue;
+            }
+            entry.kind = static_cast<std::uint32_t>(AssetPak::EntryKind::RAW);
+            entry.rawSize = bytes.size();
+            blob = bytes.data();
+            blobSize = bytes.size();
+        }
+
+        entry.offset = offset;
+        entry.size = blobSize;
+        out.write(blob, static_cast<std::streamsize>(blobSize));
+        std::uint64_t end = offset + blobSize;
+        offset = align(end);
+        out.write(padding, static_cast<std::streamsize>(offset - end));
+
+        rawTotal += entry.rawSize;
+        entries.push_back(entry);
+    }
+
+    AssetPak::Header header;
+    std::memcpy(header.magic, AssetPak::MAGIC, sizeof(header.magic));
+    header.version = AssetPak::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(entries.size());
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()),
+              static_cast<std::streamsize>(entries.size() * sizeof(AssetPak::Entry)));
+
+    if (!out) {
+        std::cerr << "Failed while writing " << outputFile << std::endl;
+        return 1;
+    }
+
+    std::cout << "Packed " << entries.size() << " assets into " << outputFile << " ("
+              << rawTotal / (1024 * 1024) << " MB raw, " << offset / (1024 * 1024) << " MB on disk)" << std::endl;
+    return 0;
+}